@@ -135,7 +135,9 @@ int main(int argc, char** argv)
     //! [X-global-domain]
     // Initialization of the global domain in X with gwx ghost points on
     // each side
-    auto const [x_domain, ghosted_x_domain, x_pre_ghost, x_post_ghost]
+    // The ghost regions are computed by the HaloExchange below
+    [[maybe_unused]] auto const
+            [x_domain, ghosted_x_domain, x_pre_ghost, x_post_ghost]
             = ddc::init_discrete_space<DDimX>(DDimX::init_ghosted<DDimX>(
                     ddc::Coordinate<X>(x_start),
                     ddc::Coordinate<X>(x_end),
@@ -143,40 +145,20 @@ int main(int argc, char** argv)
                     gwx));
     //! [X-global-domain]
 
-    //! [X-domains]
-    // our zone at the start of the domain that will be mirrored to the
-    // ghost
-    ddc::DiscreteDomain<DDimX> const
-            x_domain_begin(x_domain.front(), x_post_ghost.extents());
-    // our zone at the end of the domain that will be mirrored to the
-    // ghost
-    ddc::DiscreteDomain<DDimX> const x_domain_end(
-            x_domain.back() - x_pre_ghost.extents() + 1,
-            x_pre_ghost.extents());
-    //! [X-domains]
-
     //! [Y-domains]
     // Number of ghost points to use on each side in Y
     ddc::DiscreteVector<DDimY> static constexpr gwy {1};
 
     // Initialization of the global domain in Y with gwy ghost points on
     // each side
-    auto const [y_domain, ghosted_y_domain, y_pre_ghost, y_post_ghost]
+    // The ghost regions are computed by the HaloExchange below
+    [[maybe_unused]] auto const
+            [y_domain, ghosted_y_domain, y_pre_ghost, y_post_ghost]
             = ddc::init_discrete_space<DDimY>(DDimY::init_ghosted<DDimY>(
                     ddc::Coordinate<Y>(y_start),
                     ddc::Coordinate<Y>(y_end),
                     ddc::DiscreteVector<DDimY>(nb_y_points),
                     gwy));
-
-    // our zone at the start of the domain that will be mirrored to the
-    // ghost
-    ddc::DiscreteDomain<DDimY> const
-            y_domain_begin(y_domain.front(), y_post_ghost.extents());
-    // our zone at the end of the domain that will be mirrored to the
-    // ghost
-    ddc::DiscreteDomain<DDimY> const y_domain_end(
-            y_domain.back() - y_pre_ghost.extents() + 1,
-            y_pre_ghost.extents());
     //! [Y-domains]
 
     //! [time-domains]
@@ -238,6 +220,17 @@ int main(int argc, char** argv)
             ddc::DeviceAllocator<double>());
     //! [data allocation]
 
+    //! [halo exchange]
+    // Precomputes the ghost regions around the main domain, they are
+    // filled periodically from the main domain at each time-step
+    ddc::HaloExchange const periodic_halo(
+            ddc::DiscreteDomain<DDimX, DDimY>(x_domain, y_domain),
+            ddc::DiscreteDomain<
+                    DDimX,
+                    DDimY>(ghosted_x_domain, ghosted_y_domain),
+            ddc::HaloMode::PERIODIC);
+    //! [halo exchange]
+
     //! [initial-conditions]
     // The const qualifier makes it clear that ghosted_initial_temp always references
     // the same chunk, `ghosted_last_temp` in this case
@@ -279,19 +272,9 @@ int main(int argc, char** argv)
         //! [time iteration]
 
         //! [boundary conditions]
-        // Periodic boundary conditions
-        ddc::parallel_deepcopy(
-                ghosted_last_temp[x_pre_ghost][y_domain],
-                ghosted_last_temp[y_domain][x_domain_end]);
-        ddc::parallel_deepcopy(
-                ghosted_last_temp[y_domain][x_post_ghost],
-                ghosted_last_temp[y_domain][x_domain_begin]);
-        ddc::parallel_deepcopy(
-                ghosted_last_temp[x_domain][y_pre_ghost],
-                ghosted_last_temp[x_domain][y_domain_end]);
-        ddc::parallel_deepcopy(
-                ghosted_last_temp[x_domain][y_post_ghost],
-                ghosted_last_temp[x_domain][y_domain_begin]);
+        // Periodic boundary conditions, all ghost regions are filled
+        // by a single kernel
+        periodic_halo(ghosted_last_temp);
         //! [boundary conditions]
 
         //! [manipulated views]
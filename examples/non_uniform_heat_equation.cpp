@@ -9,6 +9,8 @@
 #include <iostream>
 #include <numeric>
 #include <random>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include <ddc/ddc.hpp>
@@ -152,11 +154,14 @@ int main(int argc, char** argv)
     //! [ghost_points_x]
 
     //! [build-domains]
+    auto x_init = DDimX::init_ghosted<DDimX>(
+            x_domain_vect,
+            x_pre_ghost_vect,
+            x_post_ghost_vect);
+    // Store the distances between points for the numerical scheme
+    std::get<0>(x_init).compute_metrics();
     auto const [x_domain, ghosted_x_domain, x_pre_ghost, x_post_ghost]
-            = ddc::init_discrete_space<DDimX>(DDimX::init_ghosted<DDimX>(
-                    x_domain_vect,
-                    x_pre_ghost_vect,
-                    x_post_ghost_vect));
+            = ddc::init_discrete_space<DDimX>(std::move(x_init));
     //! [build-domains]
 
     ddc::DiscreteDomain<DDimX> const
@@ -183,11 +188,14 @@ int main(int argc, char** argv)
     //! [Y-vectors]
 
     //! [build-Y-domain]
+    auto y_init = DDimY::init_ghosted<DDimY>(
+            y_domain_vect,
+            y_pre_ghost_vect,
+            y_post_ghost_vect);
+    // Store the distances between points for the numerical scheme
+    std::get<0>(y_init).compute_metrics();
     auto const [y_domain, ghosted_y_domain, y_pre_ghost, y_post_ghost]
-            = ddc::init_discrete_space<DDimY>(DDimY::init_ghosted<DDimY>(
-                    y_domain_vect,
-                    y_pre_ghost_vect,
-                    y_post_ghost_vect));
+            = ddc::init_discrete_space<DDimY>(std::move(y_init));
     //! [build-Y-domain]
 
     ddc::DiscreteDomain<DDimY> const
@@ -204,9 +212,8 @@ int main(int argc, char** argv)
             0.,
             ddc::reducer::max<double>(),
             [](ddc::DiscreteElement<DDimX> ix) {
-                return 1.
-                       / (ddc::distance_at_left(ix)
-                          * ddc::distance_at_right(ix));
+                return ddc::inv_distance_at_left(ix)
+                       * ddc::inv_distance_at_right(ix);
             });
 
     double const invdy2_max = ddc::transform_reduce(
@@ -214,9 +221,8 @@ int main(int argc, char** argv)
             0.,
             ddc::reducer::max<double>(),
             [](ddc::DiscreteElement<DDimY> iy) {
-                return 1.
-                       / (ddc::distance_at_left(iy)
-                          * ddc::distance_at_right(iy));
+                return ddc::inv_distance_at_left(iy)
+                       * ddc::inv_distance_at_right(iy);
             });
 
     ddc::Coordinate<T> const max_dt {
@@ -345,25 +351,33 @@ int main(int argc, char** argv)
                             = ddc::select<DDimX>(ixy);
                     ddc::DiscreteElement<DDimY> const iy
                             = ddc::select<DDimY>(ixy);
-                    double const dx_l = ddc::distance_at_left(ix);
-                    double const dx_r = ddc::distance_at_right(ix);
-                    double const dx_m = 0.5 * (dx_l + dx_r);
-                    double const dy_l = ddc::distance_at_left(iy);
-                    double const dy_r = ddc::distance_at_right(iy);
-                    double const dy_m = 0.5 * (dy_l + dy_r);
+                    double const inv_dx_l
+                            = ddc::inv_distance_at_left(ix);
+                    double const inv_dx_r
+                            = ddc::inv_distance_at_right(ix);
+                    double const inv_dy_l
+                            = ddc::inv_distance_at_left(iy);
+                    double const inv_dy_r
+                            = ddc::inv_distance_at_right(iy);
+                    double const grad_x_l
+                            = (last_temp(ix, iy) - last_temp(ix - 1, iy))
+                              * inv_dx_l;
+                    double const grad_x_r
+                            = (last_temp(ix + 1, iy) - last_temp(ix, iy))
+                              * inv_dx_r;
+                    double const grad_y_l
+                            = (last_temp(ix, iy) - last_temp(ix, iy - 1))
+                              * inv_dy_l;
+                    double const grad_y_r
+                            = (last_temp(ix, iy + 1) - last_temp(ix, iy))
+                              * inv_dy_r;
                     next_temp(ix, iy) = last_temp(ix, iy);
-                    next_temp(ix, iy)
-                            += kx * ddc::step<DDimT>()
-                               * (dx_l * last_temp(ix + 1, iy)
-                                  - 2.0 * dx_m * last_temp(ix, iy)
-                                  + dx_r * last_temp(ix - 1, iy))
-                               / (dx_l * dx_m * dx_r);
-                    next_temp(ix, iy)
-                            += ky * ddc::step<DDimT>()
-                               * (dy_l * last_temp(ix, iy + 1)
-                                  - 2.0 * dy_m * last_temp(ix, iy)
-                                  + dy_r * last_temp(ix, iy - 1))
-                               / (dy_l * dy_m * dy_r);
+                    next_temp(ix, iy) += kx * ddc::step<DDimT>()
+                                         * (grad_x_r - grad_x_l)
+                                         / ddc::midpoint_spacing(ix);
+                    next_temp(ix, iy) += ky * ddc::step<DDimT>()
+                                         * (grad_y_r - grad_y_l)
+                                         / ddc::midpoint_spacing(iy);
                 });
         //! [numerical scheme]
 
@@ -0,0 +1,204 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ddc {
+
+/// Memory usage of a set of allocations
+struct AllocationStatistics
+{
+    /// Number of bytes currently allocated
+    std::size_t current_bytes = 0;
+
+    /// Largest number of bytes allocated at once since the last reset
+    std::size_t peak_bytes = 0;
+
+    /// Number of allocations since the last reset
+    std::size_t nb_allocations = 0;
+};
+
+/** A registry of the allocations of `KokkosAllocator`, grouped by memory space and label.
+ *
+ * The registry is disabled by default. Allocations are only tracked while it is enabled, the
+ * deallocations of the tracked allocations are always recorded so that no record outlives its
+ * allocation, whose address may be reused.
+ * It complements the Kokkos Tools hooks already triggered by each labelled allocation with
+ * statistics that are available without any tool loaded.
+ */
+class AllocationRegistry
+{
+    struct Record
+    {
+        std::string memory_space;
+
+        std::string label;
+
+        std::size_t bytes;
+    };
+
+    mutable std::mutex m_mutex;
+
+    std::atomic<bool> m_enabled {false};
+
+    /// Tracked allocations still alive, indexed by address
+    std::map<void const*, Record> m_records;
+
+    std::map<std::pair<std::string, std::string>, AllocationStatistics> m_labels;
+
+    std::map<std::string, AllocationStatistics> m_memory_spaces;
+
+    static void add(AllocationStatistics& statistics, std::size_t const bytes) noexcept
+    {
+        statistics.current_bytes += bytes;
+        statistics.peak_bytes = std::max(statistics.peak_bytes, statistics.current_bytes);
+        ++statistics.nb_allocations;
+    }
+
+public:
+    AllocationRegistry() = default;
+
+    AllocationRegistry(AllocationRegistry const& x) = delete;
+
+    AllocationRegistry(AllocationRegistry&& x) = delete;
+
+    ~AllocationRegistry() = default;
+
+    AllocationRegistry& operator=(AllocationRegistry const& x) = delete;
+
+    AllocationRegistry& operator=(AllocationRegistry&& x) = delete;
+
+    void enable() noexcept
+    {
+        m_enabled = true;
+    }
+
+    void disable() noexcept
+    {
+        m_enabled = false;
+    }
+
+    bool is_enabled() const noexcept
+    {
+        return m_enabled;
+    }
+
+    /** Records an allocation of `bytes` bytes at `p`
+     * @param memory_space the name of the memory space
+     * @param label the label of the allocation
+     * @param p the address of the allocation
+     * @param bytes the size of the allocation in bytes
+     */
+    void register_allocation(
+            std::string const& memory_space,
+            std::string const& label,
+            void const* const p,
+            std::size_t const bytes)
+    {
+        if (p == nullptr) {
+            return;
+        }
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_records.insert_or_assign(p, Record {memory_space, label, bytes});
+        add(m_labels[{memory_space, label}], bytes);
+        add(m_memory_spaces[memory_space], bytes);
+    }
+
+    /// Records the deallocation of `p`, does nothing if its allocation was not recorded
+    void register_deallocation(void const* const p)
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        auto const it = m_records.find(p);
+        if (it == m_records.end()) {
+            return;
+        }
+        Record const& record = it->second;
+        m_labels[{record.memory_space, record.label}].current_bytes -= record.bytes;
+        m_memory_spaces[record.memory_space].current_bytes -= record.bytes;
+        m_records.erase(it);
+    }
+
+    /// Statistics of the allocations labelled `label` in `memory_space`
+    AllocationStatistics statistics(
+            std::string const& memory_space,
+            std::string const& label) const
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        auto const it = m_labels.find({memory_space, label});
+        return it == m_labels.end() ? AllocationStatistics() : it->second;
+    }
+
+    /// Statistics of all the allocations in `memory_space`
+    AllocationStatistics statistics(std::string const& memory_space) const
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        auto const it = m_memory_spaces.find(memory_space);
+        return it == m_memory_spaces.end() ? AllocationStatistics() : it->second;
+    }
+
+    /// Number of tracked allocations still alive
+    std::size_t nb_live_allocations() const
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        return m_records.size();
+    }
+
+    /// Writes the statistics of each memory space and label, the labels sorted by peak usage
+    void dump(std::ostream& os) const
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        for (auto const& [memory_space, space_statistics] : m_memory_spaces) {
+            os << "Allocations in " << memory_space << ": current "
+               << space_statistics.current_bytes << " B, peak " << space_statistics.peak_bytes
+               << " B\n";
+            std::vector<std::pair<std::string, AllocationStatistics>> labels;
+            for (auto const& [key, label_statistics] : m_labels) {
+                if (key.first == memory_space) {
+                    labels.emplace_back(key.second, label_statistics);
+                }
+            }
+            std::stable_sort(labels.begin(), labels.end(), [](auto const& lhs, auto const& rhs) {
+                return lhs.second.peak_bytes > rhs.second.peak_bytes;
+            });
+            for (auto const& [label, label_statistics] : labels) {
+                os << " - " << label << ": current " << label_statistics.current_bytes
+                   << " B, peak " << label_statistics.peak_bytes << " B, "
+                   << label_statistics.nb_allocations << " allocations\n";
+            }
+        }
+    }
+
+    /// Resets the peaks to the current usage and the numbers of allocations to zero
+    void reset()
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        for (auto& [key, label_statistics] : m_labels) {
+            label_statistics.peak_bytes = label_statistics.current_bytes;
+            label_statistics.nb_allocations = 0;
+        }
+        for (auto& [memory_space, space_statistics] : m_memory_spaces) {
+            space_statistics.peak_bytes = space_statistics.current_bytes;
+            space_statistics.nb_allocations = 0;
+        }
+    }
+};
+
+/// The registry of the allocations of `KokkosAllocator`
+inline AllocationRegistry& allocation_registry()
+{
+    static AllocationRegistry registry;
+    return registry;
+}
+
+} // namespace ddc
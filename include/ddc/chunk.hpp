@@ -4,32 +4,91 @@
 
 #pragma once
 
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include <experimental/mdspan>
 
+#include <Kokkos_Core.hpp>
+
 #include "ddc/chunk_common.hpp"
 #include "ddc/chunk_span.hpp"
 #include "ddc/chunk_traits.hpp"
 #include "ddc/kokkos_allocator.hpp"
+#include "ddc/layout_right_padded.hpp"
 #include "ddc/parallel_deepcopy.hpp"
+#include "ddc/parallel_for_each.hpp"
 
 namespace ddc {
 
-template <class ElementType, class, class Allocator = HostAllocator<ElementType>>
+template <
+        class ElementType,
+        class,
+        class Allocator = HostAllocator<ElementType>,
+        class LayoutPolicy = std::experimental::layout_right>
 class Chunk;
 
-template <class ElementType, class SupportType, class Allocator>
-inline constexpr bool enable_chunk<Chunk<ElementType, SupportType, Allocator>> = true;
+namespace detail {
+
+/// Value-initializes each element of a chunk it is called on
+template <class ChunkSpanType>
+class FirstTouchFunctor
+{
+    ChunkSpanType m_span;
+
+public:
+    explicit FirstTouchFunctor(ChunkSpanType const& span) : m_span(span) {}
+
+    template <class... DDims>
+    KOKKOS_FUNCTION void operator()(DiscreteElement<DDims...> const& ielem) const
+    {
+        m_span(ielem) = typename ChunkSpanType::value_type();
+    }
+};
+
+/// Whether `Allocator` provides `allocate(label, extents)`, receiving the extents of the chunk
+template <class Allocator, std::size_t Rank, class = void>
+struct is_extents_allocator : std::false_type
+{
+};
+
+template <class Allocator, std::size_t Rank>
+struct is_extents_allocator<
+        Allocator,
+        Rank,
+        std::void_t<decltype(std::declval<Allocator&>().allocate(
+                std::declval<std::string const&>(),
+                std::declval<std::array<std::size_t, Rank> const&>()))>> : std::true_type
+{
+};
+
+template <class Allocator, std::size_t Rank>
+inline constexpr bool is_extents_allocator_v = is_extents_allocator<Allocator, Rank>::value;
+
+} // namespace detail
+
+template <class ElementType, class SupportType, class Allocator, class LayoutPolicy>
+inline constexpr bool enable_chunk<Chunk<ElementType, SupportType, Allocator, LayoutPolicy>> = true;
 
-template <class ElementType, class... DDims, class Allocator>
-class Chunk<ElementType, DiscreteDomain<DDims...>, Allocator>
-    : public ChunkCommon<ElementType, DiscreteDomain<DDims...>, std::experimental::layout_right>
+template <class ElementType, class... DDims, class Allocator, class LayoutPolicy>
+class Chunk<ElementType, DiscreteDomain<DDims...>, Allocator, LayoutPolicy>
+    : public ChunkCommon<ElementType, DiscreteDomain<DDims...>, LayoutPolicy>
 {
 protected:
-    using base_type
-            = ChunkCommon<ElementType, DiscreteDomain<DDims...>, std::experimental::layout_right>;
+    using base_type = ChunkCommon<ElementType, DiscreteDomain<DDims...>, LayoutPolicy>;
+
+    static_assert(
+            detail::is_allocatable_layout_v<LayoutPolicy, typename base_type::extents_type>,
+            "The layout mapping must be constructible from the extents of the domain");
+
+    static_assert(
+            !detail::is_extents_allocator_v<Allocator, sizeof...(DDims)>
+                    || std::is_same_v<LayoutPolicy, std::experimental::layout_right>,
+            "An allocator receiving the extents stores the elements in the order of layout_right");
 
     /// ND memory view
     using internal_mdspan_type = typename base_type::internal_mdspan_type;
@@ -39,14 +98,14 @@ public:
     using span_type = ChunkSpan<
             ElementType,
             DiscreteDomain<DDims...>,
-            std::experimental::layout_right,
+            LayoutPolicy,
             typename Allocator::memory_space>;
 
     /// type of a view of this full chunk
     using view_type = ChunkSpan<
             ElementType const,
             DiscreteDomain<DDims...>,
-            std::experimental::layout_right,
+            LayoutPolicy,
             typename Allocator::memory_space>;
 
     /// The dereferenceable part of the co-domain but with indexing starting at 0
@@ -76,7 +135,7 @@ public:
 
     using reference = typename base_type::reference;
 
-    template <class, class, class>
+    template <class, class, class, class>
     friend class Chunk;
 
 private:
@@ -84,6 +143,30 @@ private:
 
     std::string m_label;
 
+    /// Number of elements to allocate for `domain`, padding included
+    static std::size_t allocation_size(mdomain_type const& domain)
+    {
+        assert(detail::in_index_range<typename extents_type::index_type>(domain.size()));
+        return mapping_type(extents_type(::ddc::extents<DDims>(domain).value()...))
+                .required_span_size();
+    }
+
+    /// Allocates the storage of `domain`, passing its extents to the allocators accepting them
+    static ElementType* allocate(
+            Allocator& allocator,
+            std::string const& label,
+            mdomain_type const& domain)
+    {
+        if constexpr (detail::is_extents_allocator_v<Allocator, sizeof...(DDims)>) {
+            return allocator.allocate(
+                    label,
+                    std::array<std::size_t, sizeof...(DDims)> {
+                            static_cast<std::size_t>(::ddc::extents<DDims>(domain).value())...});
+        } else {
+            return allocator.allocate(label, allocation_size(domain));
+        }
+    }
+
 public:
     /// Empty Chunk
     Chunk() = default;
@@ -93,7 +176,7 @@ public:
             std::string const& label,
             mdomain_type const& domain,
             Allocator allocator = Allocator())
-        : base_type(allocator.allocate(label, domain.size()), domain)
+        : base_type(allocate(allocator, label, domain), domain)
         , m_allocator(std::move(allocator))
         , m_label(label)
     {
@@ -105,6 +188,45 @@ public:
     {
     }
 
+    /** Construct a labeled Chunk on a domain with value-initialized values.
+     *
+     * The values are first written by a `parallel_for_each` over the domain in `execution_space`.
+     * On a NUMA host, the pages are thus placed close to the threads that access them in later
+     * `parallel_for_each` over the same domain, which use the same static partition. The
+     * initialization is asynchronous with respect to the host, as any kernel of `execution_space`.
+     */
+    template <
+            class ExecSpace,
+            std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>, bool> = true>
+    explicit Chunk(
+            ExecSpace const& execution_space,
+            std::string const& label,
+            mdomain_type const& domain,
+            Allocator allocator = Allocator())
+        : Chunk(label, domain, std::move(allocator))
+    {
+        static_assert(
+                Kokkos::SpaceAccessibility<ExecSpace, memory_space>::accessible,
+                "The execution space must be able to access the memory of the chunk");
+        parallel_for_each(
+                "ddc_chunk_first_touch",
+                execution_space,
+                this->m_domain,
+                detail::FirstTouchFunctor<span_type>(span_view()));
+    }
+
+    /// Construct a Chunk on a domain with value-initialized values, see the labeled constructor
+    template <
+            class ExecSpace,
+            std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>, bool> = true>
+    explicit Chunk(
+            ExecSpace const& execution_space,
+            mdomain_type const& domain,
+            Allocator allocator = Allocator())
+        : Chunk(execution_space, "no-label", domain, std::move(allocator))
+    {
+    }
+
     /// Deleted: use deepcopy instead
     Chunk(Chunk const& other) = delete;
 
@@ -122,7 +244,7 @@ public:
     ~Chunk()
     {
         if (this->m_internal_mdspan.data_handle()) {
-            m_allocator.deallocate(this->data_handle(), this->size());
+            m_allocator.deallocate(this->data_handle(), allocation_size(this->m_domain));
         }
     }
 
@@ -139,7 +261,7 @@ public:
             return *this;
         }
         if (this->m_internal_mdspan.data_handle()) {
-            m_allocator.deallocate(this->data_handle(), this->size());
+            m_allocator.deallocate(this->data_handle(), allocation_size(this->m_domain));
         }
         static_cast<base_type&>(*this) = std::move(static_cast<base_type&>(other));
         m_allocator = std::move(other.m_allocator);
@@ -190,7 +312,7 @@ public:
         static_assert((is_discrete_element_v<DElems> && ...), "Expected DiscreteElements");
         assert(((select<DDims>(take<DDims>(delems...)) >= front<DDims>(this->m_domain)) && ...));
         assert(((select<DDims>(take<DDims>(delems...)) <= back<DDims>(this->m_domain)) && ...));
-        return this->m_internal_mdspan(uid<DDims>(take<DDims>(delems...))...);
+        return this->access(delems...);
     }
 
     /** Element access using a list of DiscreteElement
@@ -206,7 +328,7 @@ public:
         static_assert((is_discrete_element_v<DElems> && ...), "Expected DiscreteElements");
         assert(((select<DDims>(take<DDims>(delems...)) >= front<DDims>(this->m_domain)) && ...));
         assert(((select<DDims>(take<DDims>(delems...)) <= back<DDims>(this->m_domain)) && ...));
-        return this->m_internal_mdspan(uid<DDims>(take<DDims>(delems...))...);
+        return this->access(delems...);
     }
 
     /** Returns the label of the Chunk
@@ -305,4 +427,20 @@ template <class... DDims, class Allocator>
 Chunk(DiscreteDomain<DDims...> const&, Allocator)
         -> Chunk<typename Allocator::value_type, DiscreteDomain<DDims...>, Allocator>;
 
+template <
+        class ExecSpace,
+        class... DDims,
+        class Allocator,
+        std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>, bool> = true>
+Chunk(ExecSpace const&, std::string const&, DiscreteDomain<DDims...> const&, Allocator)
+        -> Chunk<typename Allocator::value_type, DiscreteDomain<DDims...>, Allocator>;
+
+template <
+        class ExecSpace,
+        class... DDims,
+        class Allocator,
+        std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>, bool> = true>
+Chunk(ExecSpace const&, DiscreteDomain<DDims...> const&, Allocator)
+        -> Chunk<typename Allocator::value_type, DiscreteDomain<DDims...>, Allocator>;
+
 } // namespace ddc
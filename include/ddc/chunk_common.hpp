@@ -4,7 +4,6 @@
 
 #pragma once
 
-#include <array>
 #include <cassert>
 #include <type_traits>
 #include <utility>
@@ -30,32 +29,50 @@ KOKKOS_FUNCTION auto get_domain(ChunkType const& chunk) noexcept
     return chunk.template domain<QueryDDims...>();
 }
 
-template <class ElementType, class SupportType, class LayoutStridedPolicy>
+namespace detail {
+
+/// The extents of the chunks allocated on `SupportType`, given by `static_extent_v`
+template <class SupportType>
+struct chunk_extents;
+
+template <class... DDims>
+struct chunk_extents<DiscreteDomain<DDims...>>
+{
+    using type = std::experimental::extents<DiscreteElementType, static_extent_v<DDims>...>;
+};
+
+template <class SupportType>
+using chunk_extents_t = typename chunk_extents<SupportType>::type;
+
+} // namespace detail
+
+template <
+        class ElementType,
+        class SupportType,
+        class LayoutStridedPolicy,
+        class Extents = detail::chunk_extents_t<SupportType>>
 class ChunkCommon;
 
-template <class ElementType, class... DDims, class LayoutStridedPolicy>
-class ChunkCommon<ElementType, DiscreteDomain<DDims...>, LayoutStridedPolicy>
+template <class ElementType, class... DDims, class LayoutStridedPolicy, class Extents>
+class ChunkCommon<ElementType, DiscreteDomain<DDims...>, LayoutStridedPolicy, Extents>
 {
 protected:
-    /// the raw mdspan underlying this, with the same indexing (0 might no be dereferenceable)
-    using internal_mdspan_type = std::experimental::mdspan<
-            ElementType,
-            std::experimental::dextents<std::size_t, sizeof...(DDims)>,
-            std::experimental::layout_stride>;
+    /// the raw mdspan underlying this, indexed from the front of the domain. It keeps the layout
+    /// of the chunk so that contiguous dimensions have a compile-time unit stride, and the extents
+    /// given by `static_extent_v` so that they are known at compile time, unless the dimension was
+    /// restricted.
+    using internal_mdspan_type
+            = std::experimental::mdspan<ElementType, Extents, LayoutStridedPolicy>;
 
 public:
     using mdomain_type = DiscreteDomain<DDims...>;
 
     /// The dereferenceable part of the co-domain but with a different domain, starting at 0
-    using allocation_mdspan_type = std::experimental::mdspan<
-            ElementType,
-            std::experimental::dextents<std::size_t, sizeof...(DDims)>,
-            LayoutStridedPolicy>;
+    using allocation_mdspan_type
+            = std::experimental::mdspan<ElementType, Extents, LayoutStridedPolicy>;
 
-    using const_allocation_mdspan_type = std::experimental::mdspan<
-            const ElementType,
-            std::experimental::dextents<std::size_t, sizeof...(DDims)>,
-            LayoutStridedPolicy>;
+    using const_allocation_mdspan_type
+            = std::experimental::mdspan<const ElementType, Extents, LayoutStridedPolicy>;
 
     using discrete_element_type = typename mdomain_type::discrete_element_type;
 
@@ -78,13 +95,13 @@ public:
     using reference = typename allocation_mdspan_type::reference;
 
     // ChunkCommon, ChunkSpan and Chunk need to access to m_internal_mdspan and m_domain of other template versions
-    template <class, class, class>
+    template <class, class, class, class>
     friend class ChunkCommon;
 
-    template <class, class, class, class>
+    template <class, class, class, class, class>
     friend class ChunkSpan;
 
-    template <class, class, class>
+    template <class, class, class, class>
     friend class Chunk;
 
     static_assert(mapping_type::is_always_strided());
@@ -133,19 +150,9 @@ private:
             enable_if_t<std::is_constructible_v<Mapping, extents_type>, internal_mdspan_type>
             make_internal_mdspan(ElementType* ptr, mdomain_type const& domain)
     {
-        if (domain.empty()) {
-            return internal_mdspan_type(
-                    ptr,
-                    std::experimental::layout_stride::mapping<extents_type>());
-        }
-        extents_type extents_r(::ddc::extents<DDims>(domain).value()...);
-        mapping_type mapping_r(extents_r);
-
-        extents_type extents_s((front<DDims>(domain) + ddc::extents<DDims>(domain)).uid()...);
-        std::array<std::size_t, sizeof...(DDims)> strides_s {
-                mapping_r.stride(type_seq_rank_v<DDims, detail::TypeSeq<DDims...>>)...};
-        std::experimental::layout_stride::mapping<extents_type> mapping_s(extents_s, strides_s);
-        return internal_mdspan_type(ptr - mapping_s(front<DDims>(domain).uid()...), mapping_s);
+        return internal_mdspan_type(
+                ptr,
+                mapping_type(extents_type(::ddc::extents<DDims>(domain).value()...)));
     }
 
 public:
@@ -242,6 +249,12 @@ protected:
     {
         // Handle the case where an allocation of size 0 returns a nullptr.
         assert(domain.empty() || ((ptr != nullptr) && !domain.empty()));
+        assert(((extents_type::static_extent(type_seq_rank_v<DDims, detail::TypeSeq<DDims...>>)
+                         == std::experimental::dynamic_extent
+                 || static_cast<std::size_t>(domain.template extent<DDims>().value())
+                            == extents_type::static_extent(
+                                    type_seq_rank_v<DDims, detail::TypeSeq<DDims...>>))
+                && ...));
     }
 
     /** Constructs a new ChunkCommon by copy, yields a new view to the same data
@@ -273,11 +286,19 @@ protected:
      */
     KOKKOS_FUNCTION constexpr ElementType* data_handle() const
     {
-        ElementType* ptr = m_internal_mdspan.data_handle();
-        if (!m_domain.empty()) {
-            ptr += m_internal_mdspan.mapping()(front<DDims>(m_domain).uid()...);
-        }
-        return ptr;
+        return m_internal_mdspan.data_handle();
+    }
+
+    /** Element access using a list of DiscreteElement, indices are shifted to the front of the
+     * domain
+     * @param delems discrete elements
+     * @return reference to this element
+     */
+    template <class... DElems>
+    KOKKOS_FUNCTION constexpr reference access(DElems const&... delems) const noexcept
+    {
+        return m_internal_mdspan(
+                (uid<DDims>(take<DDims>(delems...)) - front<DDims>(m_domain).uid())...);
     }
 
     /** Provide a modifiable view of the data
@@ -293,16 +314,7 @@ protected:
      */
     KOKKOS_FUNCTION constexpr allocation_mdspan_type allocation_mdspan() const
     {
-        DDC_IF_NVCC_THEN_PUSH_AND_SUPPRESS(implicit_return_from_non_void_function)
-        extents_type extents_s(::ddc::extents<DDims>(m_domain).value()...);
-        if constexpr (std::is_same_v<LayoutStridedPolicy, std::experimental::layout_stride>) {
-            mapping_type map(extents_s, m_internal_mdspan.mapping().strides());
-            return allocation_mdspan_type(data_handle(), map);
-        } else {
-            mapping_type map(extents_s);
-            return allocation_mdspan_type(data_handle(), map);
-        }
-        DDC_IF_NVCC_THEN_POP
+        return m_internal_mdspan;
     }
 };
 
@@ -4,7 +4,6 @@
 
 #pragma once
 
-#include <array>
 #include <cassert>
 #include <cstddef>
 #include <type_traits>
@@ -16,48 +15,71 @@
 #include "ddc/detail/kokkos.hpp"
 #include "ddc/discrete_domain.hpp"
 #include "ddc/discrete_element.hpp"
+#include "ddc/layout_right_padded.hpp"
 
 namespace ddc {
 
-template <class, class, class>
+template <class, class, class, class>
 class Chunk;
 
 template <
         class ElementType,
         class SupportType,
         class LayoutStridedPolicy = std::experimental::layout_right,
-        class MemorySpace = Kokkos::DefaultHostExecutionSpace::memory_space>
+        class MemorySpace = Kokkos::DefaultHostExecutionSpace::memory_space,
+        class Extents = detail::chunk_extents_t<SupportType>>
 class ChunkSpan;
 
-template <class ElementType, class SupportType, class LayoutStridedPolicy, class MemorySpace>
-inline constexpr bool
-        enable_chunk<ChunkSpan<ElementType, SupportType, LayoutStridedPolicy, MemorySpace>> = true;
+template <
+        class ElementType,
+        class SupportType,
+        class LayoutStridedPolicy,
+        class MemorySpace,
+        class Extents>
+inline constexpr bool enable_chunk<
+        ChunkSpan<ElementType, SupportType, LayoutStridedPolicy, MemorySpace, Extents>> = true;
 
-template <class ElementType, class SupportType, class LayoutStridedPolicy, class MemorySpace>
+template <
+        class ElementType,
+        class SupportType,
+        class LayoutStridedPolicy,
+        class MemorySpace,
+        class Extents>
 inline constexpr bool enable_borrowed_chunk<
-        ChunkSpan<ElementType, SupportType, LayoutStridedPolicy, MemorySpace>> = true;
+        ChunkSpan<ElementType, SupportType, LayoutStridedPolicy, MemorySpace, Extents>> = true;
 
-template <class ElementType, class... DDims, class LayoutStridedPolicy, class MemorySpace>
-class ChunkSpan<ElementType, DiscreteDomain<DDims...>, LayoutStridedPolicy, MemorySpace>
-    : public ChunkCommon<ElementType, DiscreteDomain<DDims...>, LayoutStridedPolicy>
+template <
+        class ElementType,
+        class... DDims,
+        class LayoutStridedPolicy,
+        class MemorySpace,
+        class Extents>
+class ChunkSpan<ElementType, DiscreteDomain<DDims...>, LayoutStridedPolicy, MemorySpace, Extents>
+    : public ChunkCommon<ElementType, DiscreteDomain<DDims...>, LayoutStridedPolicy, Extents>
 {
 protected:
-    using base_type = ChunkCommon<ElementType, DiscreteDomain<DDims...>, LayoutStridedPolicy>;
+    using base_type
+            = ChunkCommon<ElementType, DiscreteDomain<DDims...>, LayoutStridedPolicy, Extents>;
 
     /// the raw mdspan underlying this, with the same indexing (0 might no be dereferenceable)
     using typename base_type::internal_mdspan_type;
 
 public:
     /// type of a span of this full chunk
-    using span_type
-            = ChunkSpan<ElementType, DiscreteDomain<DDims...>, LayoutStridedPolicy, MemorySpace>;
+    using span_type = ChunkSpan<
+            ElementType,
+            DiscreteDomain<DDims...>,
+            LayoutStridedPolicy,
+            MemorySpace,
+            Extents>;
 
     /// type of a view of this full chunk
     using view_type = ChunkSpan<
             ElementType const,
             DiscreteDomain<DDims...>,
             LayoutStridedPolicy,
-            MemorySpace>;
+            MemorySpace,
+            Extents>;
 
     using mdomain_type = DiscreteDomain<DDims...>;
 
@@ -88,7 +110,7 @@ public:
 
     using reference = typename base_type::reference;
 
-    template <class, class, class, class>
+    template <class, class, class, class, class>
     friend class ChunkSpan;
 
 protected:
@@ -133,20 +155,27 @@ public:
     KOKKOS_DEFAULTED_FUNCTION constexpr ChunkSpan(ChunkSpan&& other) = default;
 
     /** Constructs a new ChunkSpan from a Chunk, yields a new view to the same data
-     * @param other the Chunk to view
+     * @param other the Chunk to view, of any layout whose mapping converts to `mapping_type`
      */
     template <
             class OElementType,
             class Allocator,
-            class = std::enable_if_t<std::is_same_v<typename Allocator::memory_space, MemorySpace>>>
+            class OLayoutStridedPolicy,
+            class = std::enable_if_t<std::is_same_v<typename Allocator::memory_space, MemorySpace>>,
+            class = std::enable_if_t<std::is_constructible_v<
+                    mapping_type,
+                    typename Chunk<OElementType, mdomain_type, Allocator, OLayoutStridedPolicy>::
+                            mapping_type>>>
     KOKKOS_FUNCTION constexpr ChunkSpan(
-            Chunk<OElementType, mdomain_type, Allocator>& other) noexcept
-        : base_type(other.m_internal_mdspan, other.m_domain)
+            Chunk<OElementType, mdomain_type, Allocator, OLayoutStridedPolicy>& other) noexcept
+        : base_type(
+                typename base_type::internal_mdspan_type(other.m_internal_mdspan),
+                other.m_domain)
     {
     }
 
     /** Constructs a new ChunkSpan from a Chunk, yields a new view to the same data
-     * @param other the Chunk to view
+     * @param other the Chunk to view, of any layout whose mapping converts to `mapping_type`
      */
     // Disabled by SFINAE in the case of `ElementType` is not `const` to avoid write access
     template <
@@ -154,20 +183,39 @@ public:
             class SFINAEElementType = ElementType,
             class = std::enable_if_t<std::is_const_v<SFINAEElementType>>,
             class Allocator,
-            class = std::enable_if_t<std::is_same_v<typename Allocator::memory_space, MemorySpace>>>
+            class OLayoutStridedPolicy,
+            class = std::enable_if_t<std::is_same_v<typename Allocator::memory_space, MemorySpace>>,
+            class = std::enable_if_t<std::is_constructible_v<
+                    mapping_type,
+                    typename Chunk<OElementType, mdomain_type, Allocator, OLayoutStridedPolicy>::
+                            mapping_type>>>
     KOKKOS_FUNCTION constexpr ChunkSpan(
-            Chunk<OElementType, mdomain_type, Allocator> const& other) noexcept
-        : base_type(other.m_internal_mdspan, other.m_domain)
+            Chunk<OElementType, mdomain_type, Allocator, OLayoutStridedPolicy> const&
+                    other) noexcept
+        : base_type(
+                typename base_type::internal_mdspan_type(other.m_internal_mdspan),
+                other.m_domain)
     {
     }
 
     /** Constructs a new ChunkSpan by copy of a chunk, yields a new view to the same data
-     * @param other the ChunkSpan to move
+     * @param other the ChunkSpan to move, whose extents convert implicitly to `extents_type`
      */
-    template <class OElementType>
+    template <
+            class OElementType,
+            class OExtents,
+            class = std::enable_if_t<std::is_convertible_v<
+                    typename ChunkSpan<
+                            OElementType,
+                            mdomain_type,
+                            layout_type,
+                            MemorySpace,
+                            OExtents>::allocation_mdspan_type,
+                    allocation_mdspan_type>>>
     KOKKOS_FUNCTION constexpr ChunkSpan(
-            ChunkSpan<OElementType, mdomain_type, layout_type, MemorySpace> const& other) noexcept
-        : base_type(other.m_internal_mdspan, other.m_domain)
+            ChunkSpan<OElementType, mdomain_type, layout_type, MemorySpace, OExtents> const&
+                    other) noexcept
+        : base_type(internal_mdspan_type(other.m_internal_mdspan), other.m_domain)
     {
     }
 
@@ -190,23 +238,31 @@ public:
     KOKKOS_FUNCTION constexpr ChunkSpan(
             allocation_mdspan_type allocation_mdspan,
             mdomain_type const& domain)
+        : base_type(std::move(allocation_mdspan), domain)
     {
-        assert(((allocation_mdspan.extent(type_seq_rank_v<DDims, detail::TypeSeq<DDims...>>)
+        assert(((this->m_internal_mdspan.extent(type_seq_rank_v<DDims, detail::TypeSeq<DDims...>>)
                  == static_cast<std::size_t>(domain.template extent<DDims>().value()))
                 && ...));
-        namespace stdex = std::experimental;
-        if (!domain.empty()) {
-            extents_type extents_s((front<DDims>(domain) + extents<DDims>(domain)).uid()...);
-            std::array<std::size_t, sizeof...(DDims)> strides_s {allocation_mdspan.mapping().stride(
-                    type_seq_rank_v<DDims, detail::TypeSeq<DDims...>>)...};
-            stdex::layout_stride::mapping<extents_type> mapping_s(extents_s, strides_s);
-            this->m_internal_mdspan = internal_mdspan_type(
-                    allocation_mdspan.data_handle() - mapping_s(front<DDims>(domain).uid()...),
-                    mapping_s);
-        } else {
-            this->m_internal_mdspan = allocation_mdspan;
-        }
-        this->m_domain = domain;
+    }
+
+    /** Constructs a new ChunkSpan from an mdspan with more dynamic extents, e.g. a subview
+     * @param allocation_mdspan the allocation mdspan to the data
+     * @param domain the domain that sustains the view
+     */
+    template <
+            class OElementType,
+            class OExtents,
+            class MDSpan = std::experimental::mdspan<OElementType, OExtents, LayoutStridedPolicy>,
+            std::enable_if_t<
+                    !std::is_convertible_v<MDSpan, allocation_mdspan_type>
+                            && std::is_constructible_v<allocation_mdspan_type, MDSpan>,
+                    int> = 0>
+    KOKKOS_FUNCTION constexpr ChunkSpan(
+            std::experimental::mdspan<OElementType, OExtents, LayoutStridedPolicy> const&
+                    allocation_mdspan,
+            mdomain_type const& domain)
+        : ChunkSpan(allocation_mdspan_type(allocation_mdspan), domain)
+    {
     }
 
     /** Constructs a new ChunkSpan from scratch
@@ -235,35 +291,43 @@ public:
      */
     KOKKOS_DEFAULTED_FUNCTION constexpr ChunkSpan& operator=(ChunkSpan&& other) = default;
 
-    /** Slice out some dimensions
+    /** Slice out some dimensions, the remaining ones keep their extents
      */
     template <class... QueryDDims>
     KOKKOS_FUNCTION constexpr auto operator[](
             DiscreteElement<QueryDDims...> const& slice_spec) const
     {
-        auto subview = std::experimental::
-                submdspan(allocation_mdspan(), get_slicer_for<DDims>(slice_spec)...);
+        auto subview = std::experimental::submdspan(
+                detail::as_submdspan_compatible(allocation_mdspan()),
+                get_slicer_for<DDims>(slice_spec)...);
         using detail::TypeSeq;
         using selected_meshes = type_seq_remove_t<TypeSeq<DDims...>, TypeSeq<QueryDDims...>>;
         return ChunkSpan<
                 ElementType,
                 decltype(select_by_type_seq<selected_meshes>(this->m_domain)),
                 typename decltype(subview)::layout_type,
-                memory_space>(subview, select_by_type_seq<selected_meshes>(this->m_domain));
+                memory_space,
+                typename decltype(subview)::extents_type>(
+                subview,
+                select_by_type_seq<selected_meshes>(this->m_domain));
     }
 
-    /** Restrict to a subdomain
+    /** Restrict to a subdomain, the restricted dimensions get a dynamic extent
      */
     template <class... QueryDDims>
     KOKKOS_FUNCTION constexpr auto operator[](DiscreteDomain<QueryDDims...> const& odomain) const
     {
-        auto subview = std::experimental::
-                submdspan(allocation_mdspan(), get_slicer_for<DDims>(odomain)...);
+        auto subview = std::experimental::submdspan(
+                detail::as_submdspan_compatible(allocation_mdspan()),
+                get_slicer_for<DDims>(odomain)...);
         return ChunkSpan<
                 ElementType,
                 decltype(this->m_domain.restrict(odomain)),
                 typename decltype(subview)::layout_type,
-                memory_space>(subview, this->m_domain.restrict(odomain));
+                memory_space,
+                typename decltype(subview)::extents_type>(
+                subview,
+                this->m_domain.restrict(odomain));
     }
 
     /** Element access using a list of DiscreteElement
@@ -279,7 +343,7 @@ public:
         static_assert((is_discrete_element_v<DElems> && ...), "Expected DiscreteElements");
         assert(((select<DDims>(take<DDims>(delems...)) >= front<DDims>(this->m_domain)) && ...));
         assert(((select<DDims>(take<DDims>(delems...)) <= back<DDims>(this->m_domain)) && ...));
-        return this->m_internal_mdspan(uid<DDims>(take<DDims>(delems...))...);
+        return this->access(delems...);
     }
 
     /** Access to the underlying allocation pointer
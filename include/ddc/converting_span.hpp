@@ -0,0 +1,298 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <experimental/mdspan>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc/chunk_traits.hpp"
+#include "ddc/discrete_domain.hpp"
+#include "ddc/discrete_element.hpp"
+
+namespace ddc {
+
+namespace detail {
+
+/// Reference to a `StorageType` value, converted from and to `ComputeType` on load and store
+template <class ComputeType, class StorageType>
+class ConvertingReference
+{
+    StorageType* m_ptr;
+
+public:
+    KOKKOS_FUNCTION explicit constexpr ConvertingReference(StorageType* const ptr) noexcept
+        : m_ptr(ptr)
+    {
+    }
+
+    KOKKOS_DEFAULTED_FUNCTION constexpr ConvertingReference(ConvertingReference const& other)
+            = default;
+
+    KOKKOS_FUNCTION constexpr operator ComputeType() const noexcept
+    {
+        return static_cast<ComputeType>(*m_ptr);
+    }
+
+    KOKKOS_FUNCTION constexpr ConvertingReference const& operator=(
+            ComputeType const& value) const noexcept
+    {
+        *m_ptr = static_cast<StorageType>(value);
+        return *this;
+    }
+
+    /// Assigns the referenced value, not the reference
+    KOKKOS_FUNCTION constexpr ConvertingReference const& operator=(
+            ConvertingReference const& other) const noexcept
+    {
+        return *this = static_cast<ComputeType>(other);
+    }
+
+    KOKKOS_FUNCTION constexpr ConvertingReference const& operator+=(
+            ComputeType const& value) const noexcept
+    {
+        return *this = static_cast<ComputeType>(*this) + value;
+    }
+
+    KOKKOS_FUNCTION constexpr ConvertingReference const& operator-=(
+            ComputeType const& value) const noexcept
+    {
+        return *this = static_cast<ComputeType>(*this) - value;
+    }
+
+    KOKKOS_FUNCTION constexpr ConvertingReference const& operator*=(
+            ComputeType const& value) const noexcept
+    {
+        return *this = static_cast<ComputeType>(*this) * value;
+    }
+
+    KOKKOS_FUNCTION constexpr ConvertingReference const& operator/=(
+            ComputeType const& value) const noexcept
+    {
+        return *this = static_cast<ComputeType>(*this) / value;
+    }
+};
+
+} // namespace detail
+
+/** An mdspan accessor policy reading and writing `StorageType` values as `ComputeType` values.
+ *
+ * Loads are converted to `ComputeType` and stores are converted back to `StorageType`, e.g. to
+ * compute in double precision on fields stored in single precision. A const `StorageType` gives
+ * read-only access returning the converted values.
+ */
+template <class StorageType, class ComputeType>
+struct converting_accessor
+{
+    using offset_policy = converting_accessor;
+
+    using element_type = ComputeType;
+
+    using reference = detail::ConvertingReference<ComputeType, StorageType>;
+
+    using data_handle_type = StorageType*;
+
+    KOKKOS_FUNCTION constexpr reference access(data_handle_type const p, std::size_t const i)
+            const noexcept
+    {
+        return reference(p + i);
+    }
+
+    KOKKOS_FUNCTION constexpr data_handle_type offset(data_handle_type const p, std::size_t const i)
+            const noexcept
+    {
+        return p + i;
+    }
+};
+
+template <class StorageType, class ComputeType>
+struct converting_accessor<StorageType const, ComputeType>
+{
+    using offset_policy = converting_accessor;
+
+    using element_type = ComputeType const;
+
+    using reference = ComputeType;
+
+    using data_handle_type = StorageType const*;
+
+    KOKKOS_FUNCTION constexpr reference access(data_handle_type const p, std::size_t const i)
+            const noexcept
+    {
+        return static_cast<reference>(p[i]);
+    }
+
+    KOKKOS_FUNCTION constexpr data_handle_type offset(data_handle_type const p, std::size_t const i)
+            const noexcept
+    {
+        return p + i;
+    }
+};
+
+template <class ComputeType, class StorageSpan>
+class ConvertingSpan;
+
+template <class ComputeType, class StorageSpan>
+inline constexpr bool enable_chunk<ConvertingSpan<ComputeType, StorageSpan>> = true;
+
+template <class ComputeType, class StorageSpan>
+inline constexpr bool enable_borrowed_chunk<ConvertingSpan<ComputeType, StorageSpan>> = true;
+
+/** A view of a borrowed chunk of `StorageType` values through which they are read and written
+ * as `ComputeType` values.
+ *
+ * It indexes and slices like the underlying `ChunkSpan`, so that kernels written for a
+ * `ChunkSpan` of `ComputeType` work unchanged while the chunk is allocated in the smaller
+ * storage type. It is a borrowed chunk whose `chunk_traits` describe the storage:
+ * `parallel_fill` converts the value once and `parallel_deepcopy` converts each element when
+ * the other chunk holds another type.
+ */
+template <class ComputeType, class StorageSpan>
+class ConvertingSpan
+{
+    static_assert(is_borrowed_chunk_v<StorageSpan>);
+
+    using storage_element_type = typename StorageSpan::element_type;
+
+    using accessor_type = converting_accessor<storage_element_type, ComputeType>;
+
+    StorageSpan m_storage;
+
+public:
+    using storage_span_type = StorageSpan;
+
+    using mdomain_type = typename StorageSpan::mdomain_type;
+
+    using memory_space = typename StorageSpan::memory_space;
+
+    using extents_type = typename StorageSpan::extents_type;
+
+    using layout_type = typename StorageSpan::layout_type;
+
+    using mapping_type = typename StorageSpan::mapping_type;
+
+    using element_type = typename accessor_type::element_type;
+
+    using reference = typename accessor_type::reference;
+
+    using allocation_mdspan_type = std::experimental::mdspan<
+            element_type,
+            typename StorageSpan::extents_type,
+            typename StorageSpan::layout_type,
+            accessor_type>;
+
+    KOKKOS_DEFAULTED_FUNCTION constexpr ConvertingSpan() = default;
+
+    KOKKOS_FUNCTION explicit constexpr ConvertingSpan(StorageSpan const& storage) noexcept
+        : m_storage(storage)
+    {
+    }
+
+    /// The viewed chunk, in the storage type
+    KOKKOS_FUNCTION constexpr StorageSpan const& storage() const noexcept
+    {
+        return m_storage;
+    }
+
+    KOKKOS_FUNCTION constexpr mdomain_type domain() const noexcept
+    {
+        return m_storage.domain();
+    }
+
+    template <class... QueryDDims>
+    KOKKOS_FUNCTION constexpr DiscreteDomain<QueryDDims...> domain() const noexcept
+    {
+        return m_storage.template domain<QueryDDims...>();
+    }
+
+    /** Element access using a list of DiscreteElement
+     * @param delems discrete coordinates
+     * @return a reference converting the element on load and store
+     */
+    template <class... DElems>
+    KOKKOS_FUNCTION constexpr reference operator()(DElems const&... delems) const noexcept
+    {
+        return accessor_type().access(&m_storage(delems...), 0);
+    }
+
+    /// Slice out some dimensions
+    template <class QueryDDimsOrDomain>
+    KOKKOS_FUNCTION constexpr auto operator[](QueryDDimsOrDomain const& slice_spec) const
+    {
+        using slice_type = decltype(m_storage[slice_spec]);
+        return ConvertingSpan<ComputeType, slice_type>(m_storage[slice_spec]);
+    }
+
+    /** Access to the underlying allocation pointer
+     * @return allocation pointer, in the storage type
+     */
+    KOKKOS_FUNCTION constexpr auto data_handle() const
+    {
+        return m_storage.data_handle();
+    }
+
+    KOKKOS_FUNCTION constexpr mapping_type mapping() const noexcept
+    {
+        return m_storage.mapping();
+    }
+
+    /** Provide an mdspan on the memory allocation, converting on load and store
+     * @return allocation mdspan
+     */
+    KOKKOS_FUNCTION constexpr allocation_mdspan_type allocation_mdspan() const
+    {
+        auto const s = m_storage.allocation_mdspan();
+        return allocation_mdspan_type(s.data_handle(), s.mapping(), accessor_type());
+    }
+
+    /** Provide an unmanaged `Kokkos::View` on the memory allocation
+     * @return allocation `Kokkos::View`, in the storage type
+     */
+    KOKKOS_FUNCTION constexpr auto allocation_kokkos_view() const
+    {
+        return m_storage.allocation_kokkos_view();
+    }
+
+    KOKKOS_FUNCTION constexpr auto span_cview() const
+    {
+        using view_type = decltype(m_storage.span_cview());
+        return ConvertingSpan<ComputeType, view_type>(m_storage.span_cview());
+    }
+
+    KOKKOS_FUNCTION constexpr ConvertingSpan span_view() const
+    {
+        return *this;
+    }
+};
+
+/** Views a borrowed chunk stored as `StorageType` through `ComputeType` values
+ * @param[in] chunk a borrowed chunk
+ * @return a ConvertingSpan on `chunk`
+ */
+template <class ComputeType, class ChunkType>
+auto converting_view(ChunkType&& chunk)
+{
+    static_assert(is_borrowed_chunk_v<ChunkType>);
+    auto const span = chunk.span_view();
+    return ConvertingSpan<ComputeType, std::remove_const_t<decltype(span)>>(span);
+}
+
+/** Views a borrowed chunk stored as `StorageType` through read-only `ComputeType` values
+ * @param[in] chunk a borrowed chunk
+ * @return a read-only ConvertingSpan on `chunk`
+ */
+template <class ComputeType, class ChunkType>
+auto converting_cview(ChunkType&& chunk)
+{
+    static_assert(is_borrowed_chunk_v<ChunkType>);
+    auto const span = chunk.span_cview();
+    return ConvertingSpan<ComputeType, std::remove_const_t<decltype(span)>>(span);
+}
+
+} // namespace ddc
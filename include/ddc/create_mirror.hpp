@@ -10,6 +10,7 @@
 
 #include "ddc/chunk_span.hpp"
 #include "ddc/kokkos_allocator.hpp"
+#include "ddc/layout_right_padded.hpp"
 
 namespace ddc {
 
@@ -20,9 +21,15 @@ auto create_mirror(
         ChunkSpan<ElementType, Support, Layout, MemorySpace> const& src)
 {
     static_assert(
-            std::is_same_v<Layout, std::experimental::layout_right>,
-            "Only layout right is supported");
-    return Chunk(
+            detail::is_allocatable_layout_v<
+                    Layout,
+                    typename ChunkSpan<ElementType, Support, Layout, MemorySpace>::extents_type>,
+            "Only layouts constructible from the extents of the domain are supported");
+    return Chunk<
+            std::remove_const_t<ElementType>,
+            Support,
+            KokkosAllocator<std::remove_const_t<ElementType>, typename Space::memory_space>,
+            Layout>(
             src.domain(),
             KokkosAllocator<std::remove_const_t<ElementType>, typename Space::memory_space>());
 }
@@ -32,9 +39,15 @@ template <class ElementType, class Support, class Layout, class MemorySpace>
 auto create_mirror(ChunkSpan<ElementType, Support, Layout, MemorySpace> const& src)
 {
     static_assert(
-            std::is_same_v<Layout, std::experimental::layout_right>,
-            "Only layout right is supported");
-    return Chunk(src.domain(), HostAllocator<std::remove_const_t<ElementType>>());
+            detail::is_allocatable_layout_v<
+                    Layout,
+                    typename ChunkSpan<ElementType, Support, Layout, MemorySpace>::extents_type>,
+            "Only layouts constructible from the extents of the domain are supported");
+    return Chunk<
+            std::remove_const_t<ElementType>,
+            Support,
+            HostAllocator<std::remove_const_t<ElementType>>,
+            Layout>(src.domain(), HostAllocator<std::remove_const_t<ElementType>>());
 }
 
 /// Returns a new `Chunk` with the same layout as `src` allocated on the memory space `Space::memory_space` and operates a deep copy between the two.
@@ -44,8 +57,10 @@ auto create_mirror_and_copy(
         ChunkSpan<ElementType, Support, Layout, MemorySpace> const& src)
 {
     static_assert(
-            std::is_same_v<Layout, std::experimental::layout_right>,
-            "Only layout right is supported");
+            detail::is_allocatable_layout_v<
+                    Layout,
+                    typename ChunkSpan<ElementType, Support, Layout, MemorySpace>::extents_type>,
+            "Only layouts constructible from the extents of the domain are supported");
     Chunk chunk = create_mirror(space, src);
     parallel_deepcopy(space, chunk, src);
     return chunk;
@@ -56,8 +71,10 @@ template <class ElementType, class Support, class Layout, class MemorySpace>
 auto create_mirror_and_copy(ChunkSpan<ElementType, Support, Layout, MemorySpace> const& src)
 {
     static_assert(
-            std::is_same_v<Layout, std::experimental::layout_right>,
-            "Only layout right is supported");
+            detail::is_allocatable_layout_v<
+                    Layout,
+                    typename ChunkSpan<ElementType, Support, Layout, MemorySpace>::extents_type>,
+            "Only layouts constructible from the extents of the domain are supported");
     Chunk chunk = create_mirror(src);
     parallel_deepcopy(chunk, src);
     return chunk;
@@ -71,8 +88,10 @@ auto create_mirror_view(
         ChunkSpan<ElementType, Support, Layout, MemorySpace> const& src)
 {
     static_assert(
-            std::is_same_v<Layout, std::experimental::layout_right>,
-            "Only layout right is supported");
+            detail::is_allocatable_layout_v<
+                    Layout,
+                    typename ChunkSpan<ElementType, Support, Layout, MemorySpace>::extents_type>,
+            "Only layouts constructible from the extents of the domain are supported");
     if constexpr (Kokkos::SpaceAccessibility<Space, MemorySpace>::accessible) {
         return src;
     } else {
@@ -86,8 +105,10 @@ template <class ElementType, class Support, class Layout, class MemorySpace>
 auto create_mirror_view(ChunkSpan<ElementType, Support, Layout, MemorySpace> const& src)
 {
     static_assert(
-            std::is_same_v<Layout, std::experimental::layout_right>,
-            "Only layout right is supported");
+            detail::is_allocatable_layout_v<
+                    Layout,
+                    typename ChunkSpan<ElementType, Support, Layout, MemorySpace>::extents_type>,
+            "Only layouts constructible from the extents of the domain are supported");
     if constexpr (Kokkos::SpaceAccessibility<Kokkos::HostSpace, MemorySpace>::accessible) {
         return src;
     } else {
@@ -103,8 +124,10 @@ auto create_mirror_view_and_copy(
         ChunkSpan<ElementType, Support, Layout, MemorySpace> const& src)
 {
     static_assert(
-            std::is_same_v<Layout, std::experimental::layout_right>,
-            "Only layout right is supported");
+            detail::is_allocatable_layout_v<
+                    Layout,
+                    typename ChunkSpan<ElementType, Support, Layout, MemorySpace>::extents_type>,
+            "Only layouts constructible from the extents of the domain are supported");
     if constexpr (Kokkos::SpaceAccessibility<Space, MemorySpace>::accessible) {
         return src;
     } else {
@@ -118,8 +141,10 @@ template <class ElementType, class Support, class Layout, class MemorySpace>
 auto create_mirror_view_and_copy(ChunkSpan<ElementType, Support, Layout, MemorySpace> const& src)
 {
     static_assert(
-            std::is_same_v<Layout, std::experimental::layout_right>,
-            "Only layout right is supported");
+            detail::is_allocatable_layout_v<
+                    Layout,
+                    typename ChunkSpan<ElementType, Support, Layout, MemorySpace>::extents_type>,
+            "Only layouts constructible from the extents of the domain are supported");
     if constexpr (Kokkos::SpaceAccessibility<Kokkos::HostSpace, MemorySpace>::accessible) {
         return src;
     } else {
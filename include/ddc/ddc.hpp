@@ -18,26 +18,40 @@ namespace ddc {
 
 // Containers
 #include "ddc/aligned_allocator.hpp"
+#include "ddc/allocation_registry.hpp"
 #include "ddc/chunk.hpp"
 #include "ddc/chunk_span.hpp"
 #include "ddc/chunk_traits.hpp"
+#include "ddc/converting_span.hpp"
+#include "ddc/huge_page_allocator.hpp"
 #include "ddc/kokkos_allocator.hpp"
+#include "ddc/layout_right_padded.hpp"
+#include "ddc/mmap_allocator.hpp"
+#include "ddc/multi_chunk.hpp"
+#include "ddc/multi_patch.hpp"
+#include "ddc/pool_allocator.hpp"
+#include "ddc/scratch_arena.hpp"
 
 // Discretizations
 #include "ddc/discrete_domain.hpp"
 #include "ddc/discrete_element.hpp"
 #include "ddc/discrete_space.hpp"
 #include "ddc/discrete_vector.hpp"
+#include "ddc/discretization_context.hpp"
+#include "ddc/mapped_sampling.hpp"
 #include "ddc/non_uniform_point_sampling.hpp"
 #include "ddc/periodic_sampling.hpp"
 #include "ddc/uniform_point_sampling.hpp"
 
 // Algorithms
 #include "ddc/create_mirror.hpp"
+#include "ddc/find_cell.hpp"
 #include "ddc/for_each.hpp"
+#include "ddc/halo_exchange.hpp"
 #include "ddc/parallel_deepcopy.hpp"
 #include "ddc/parallel_fill.hpp"
 #include "ddc/parallel_for_each.hpp"
+#include "ddc/parallel_stencil.hpp"
 #include "ddc/parallel_transform_reduce.hpp"
 #include "ddc/reducer.hpp"
 #include "ddc/transform_reduce.hpp"
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cassert>
 #include <type_traits>
 #include <utility>
 
@@ -18,18 +19,36 @@
 
 namespace ddc::detail {
 
+/// True if `Impl` can copy the data of another instance in its own storage, see `assign`
+template <class Impl, class = void>
+struct is_assignable_discretization : std::false_type
+{
+};
+
+template <class Impl>
+struct is_assignable_discretization<
+        Impl,
+        std::void_t<decltype(std::declval<Impl&>().assign(std::declval<Impl const&>()))>>
+    : std::true_type
+{
+};
+
 template <class DDim>
 class DualDiscretization
 {
-    using DDimImplHost = typename DDim::template Impl<DDim, Kokkos::HostSpace>;
+public:
 #if defined(__CUDACC__)
-    using DDimImplDevice = typename DDim::template Impl<DDim, Kokkos::CudaSpace>;
+    using device_memory_space = Kokkos::CudaSpace;
 #elif defined(__HIPCC__)
-    using DDimImplDevice = typename DDim::template Impl<DDim, Kokkos::HIPSpace>;
+    using device_memory_space = Kokkos::HIPSpace;
 #else
-    using DDimImplDevice = DDimImplHost;
+    using device_memory_space = Kokkos::HostSpace;
 #endif
 
+private:
+    using DDimImplHost = typename DDim::template Impl<DDim, Kokkos::HostSpace>;
+    using DDimImplDevice = typename DDim::template Impl<DDim, device_memory_space>;
+
     DDimImplHost m_host;
 #if defined(__CUDACC__) || defined(__HIPCC__)
     DDimImplDevice m_device_on_host;
@@ -45,6 +64,26 @@ public:
     {
     }
 
+    /** Copies `impl` into the host and device instances if the discretization provides an
+     * `assign` member function and the sizes of their storages match
+     * @return false, leaving the instances unchanged, otherwise
+     */
+    bool assign(DDimImplHost const& impl)
+    {
+        if constexpr (is_assignable_discretization<DDimImplHost>::value) {
+            if (!m_host.assign(impl)) {
+                return false;
+            }
+#if defined(__CUDACC__) || defined(__HIPCC__)
+            [[maybe_unused]] bool const assigned = m_device_on_host.assign(m_host);
+            assert(assigned);
+#endif
+            return true;
+        } else {
+            return false;
+        }
+    }
+
     template <class MemorySpace>
     KOKKOS_FUNCTION typename DDim::template Impl<DDim, MemorySpace> const& get()
     {
@@ -65,12 +104,12 @@ public:
         }
     }
 
-    KOKKOS_FUNCTION DDimImplHost const& get_host()
+    KOKKOS_FUNCTION DDimImplHost const& get_host() const
     {
         return m_host;
     }
 
-    KOKKOS_FUNCTION DDimImplDevice const& get_device()
+    KOKKOS_FUNCTION DDimImplDevice const& get_device() const
     {
 #if defined(__CUDACC__) || defined(__HIPCC__)
         return m_device_on_host;
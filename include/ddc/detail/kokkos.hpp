@@ -13,6 +13,7 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "ddc/layout_right_padded.hpp"
 #include "macros.hpp"
 
 namespace ddc::detail {
@@ -57,8 +58,9 @@ using kokkos_to_mdspan_layout_t = typename kokkos_to_mdspan_layout<KokkosLP>::ty
 template <class mdspanLP>
 struct mdspan_to_kokkos_layout
 {
+    // Dependent on mdspanLP so that it only fires when the primary template is instantiated
     static_assert(
-            std::is_same_v<mdspanLP, mdspanLP>,
+            !std::is_same_v<mdspanLP, mdspanLP>,
             "Usage of non-specialized mdspan_to_kokkos_layout struct is not allowed");
 };
 
@@ -80,6 +82,29 @@ struct mdspan_to_kokkos_layout<std::experimental::layout_stride>
     using type = Kokkos::LayoutStride;
 };
 
+/// The padding of the rows has no Kokkos counterpart, padded views are strided
+template <std::size_t PaddingValue>
+struct mdspan_to_kokkos_layout<layout_right_padded<PaddingValue>>
+{
+    using type = Kokkos::LayoutStride;
+};
+
+/// Whether `mdspan_to_kokkos_layout` is specialized for `mdspanLP`
+template <class mdspanLP>
+inline constexpr bool has_kokkos_layout_v = false;
+
+template <>
+inline constexpr bool has_kokkos_layout_v<std::experimental::layout_left> = true;
+
+template <>
+inline constexpr bool has_kokkos_layout_v<std::experimental::layout_right> = true;
+
+template <>
+inline constexpr bool has_kokkos_layout_v<std::experimental::layout_stride> = true;
+
+template <std::size_t PaddingValue>
+inline constexpr bool has_kokkos_layout_v<layout_right_padded<PaddingValue>> = true;
+
 /// Alias template to transform a Kokkos layout type to a mdspan layout type
 template <class mdspanLP>
 using mdspan_to_kokkos_layout_t = typename mdspan_to_kokkos_layout<mdspanLP>::type;
@@ -10,6 +10,8 @@
 #include <tuple>
 #include <type_traits>
 
+#include <experimental/mdspan>
+
 #include "ddc/detail/type_seq.hpp"
 #include "ddc/discrete_element.hpp"
 #include "ddc/discrete_vector.hpp"
@@ -35,6 +37,18 @@ struct is_discrete_domain<DiscreteDomain<Tags...>> : std::true_type
 template <class T>
 inline constexpr bool is_discrete_domain_v = is_discrete_domain<T>::value;
 
+/** The number of elements of the domains of `DDim` when it is known at compile time,
+ * `std::experimental::dynamic_extent` otherwise.
+ *
+ * It can be specialized for small dimensions, e.g. the components of a vector or the derivatives
+ * at a boundary, to make their extent static in the mdspans of the chunks and to fully unroll the
+ * serial loops over the whole dimension. Every domain of a chunk in `DDim` must then have this
+ * number of elements, the serial loops over a subdomain are not unrolled and the spans restricted
+ * to a subdomain of `DDim` get a dynamic extent.
+ */
+template <class DDim>
+inline constexpr std::size_t static_extent_v = std::experimental::dynamic_extent;
+
 
 namespace detail {
 
@@ -5,7 +5,9 @@
 #pragma once
 
 #include <array>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <ostream>
 #include <type_traits>
 #include <utility>
@@ -45,7 +47,11 @@ struct ToTypeSeq<DiscreteElement<Tags...>>
 
 /** A DiscreteCoordElement is a scalar that identifies an element of the discrete dimension
  */
+#ifdef DDC_BUILD_32BIT_INDICES
+using DiscreteElementType = std::uint32_t;
+#else
 using DiscreteElementType = std::size_t;
+#endif
 
 template <class Tag>
 KOKKOS_FUNCTION constexpr DiscreteElementType const& uid(DiscreteElement<Tag> const& tuple) noexcept
@@ -184,6 +190,7 @@ public:
     explicit KOKKOS_FUNCTION constexpr DiscreteElement(Params const&... params) noexcept
         : m_values {static_cast<value_type>(params)...}
     {
+        assert((detail::in_index_range<value_type>(params) && ...));
     }
 
     KOKKOS_DEFAULTED_FUNCTION ~DiscreteElement() = default;
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
 #include <functional>
 #include <map>
 #include <optional>
@@ -112,6 +113,10 @@ inline std::optional<std::map<std::string, std::function<void()>>> g_discretizat
 template <class DDim>
 inline std::optional<DualDiscretization<DDim>> g_discrete_space_dual;
 
+// Global CPU variable counting the initializations of discrete spaces, never reset
+template <class DDim>
+inline std::size_t g_discrete_space_version = 0;
+
 #if defined(__CUDACC__)
 // Global GPU variable viewing data owned by the CPU
 template <class DDim>
@@ -141,6 +146,23 @@ auto extract_after(Tuple&& t, std::index_sequence<Ids...>)
     return std::make_tuple(std::move(std::get<Ids + 1>(t))...);
 }
 
+/// Copies the device instance of the global discrete space `DDim` to the GPU global variable
+template <class DDim>
+void copy_discrete_space_to_device()
+{
+#if defined(__CUDACC__)
+    CUDA_THROW_ON_ERROR(cudaMemcpyToSymbol(
+            g_discrete_space_device<DDim>,
+            &g_discrete_space_dual<DDim>->get_device(),
+            sizeof(g_discrete_space_dual<DDim>->get_device())));
+#elif defined(__HIPCC__)
+    HIP_THROW_ON_ERROR(hipMemcpyToSymbol(
+            g_discrete_space_device<DDim>,
+            &g_discrete_space_dual<DDim>->get_device(),
+            sizeof(g_discrete_space_dual<DDim>->get_device())));
+#endif
+}
+
 } // namespace detail
 
 /** Initialize (emplace) a global singleton discrete space
@@ -160,17 +182,8 @@ void init_discrete_space(Args&&... args)
     detail::g_discretization_store->emplace(typeid(DDim).name(), []() {
         detail::g_discrete_space_dual<DDim>.reset();
     });
-#if defined(__CUDACC__)
-    CUDA_THROW_ON_ERROR(cudaMemcpyToSymbol(
-            detail::g_discrete_space_device<DDim>,
-            &detail::g_discrete_space_dual<DDim>->get_device(),
-            sizeof(detail::g_discrete_space_dual<DDim>->get_device())));
-#elif defined(__HIPCC__)
-    HIP_THROW_ON_ERROR(hipMemcpyToSymbol(
-            detail::g_discrete_space_device<DDim>,
-            &detail::g_discrete_space_dual<DDim>->get_device(),
-            sizeof(detail::g_discrete_space_dual<DDim>->get_device())));
-#endif
+    detail::copy_discrete_space_to_device<DDim>();
+    ++detail::g_discrete_space_version<DDim>;
 }
 
 /** Move construct a global singleton discrete space and pass through the other argument
@@ -197,6 +210,77 @@ std::tuple<Arg0, Arg1, Args...> init_discrete_space(std::tuple<DDimImpl, Arg0, A
     return detail::extract_after(std::move(a), std::index_sequence_for<Arg0, Arg1, Args...>());
 }
 
+/** Replace an initialized global singleton discrete space, e.g. to move or adapt a mesh
+ *
+ * A new host instance is first built from `args`. If the discretization provides an `assign`
+ * member function and the sizes of the storages match, it is copied into the existing host and
+ * device instances, whose storage is reused, the GPU global variable being only copied again if
+ * the device instance changed. Otherwise the instances are replaced. In both cases, the version
+ * of the discrete space is incremented.
+ * The chunks defined on a domain of `DDim` keep their values, they are not interpolated.
+ *
+ * @param args the constructor arguments
+ */
+template <class DDim, class... Args>
+void reinit_discrete_space(Args&&... args)
+{
+    if (!detail::g_discrete_space_dual<DDim>) {
+        throw std::runtime_error("Discrete space function not initialized.");
+    }
+    detail::ddim_impl_t<DDim, Kokkos::HostSpace> impl(std::forward<Args>(args)...);
+#if defined(__CUDACC__) || defined(__HIPCC__)
+    using device_impl_type = std::remove_cv_t<
+            std::remove_reference_t<decltype(detail::g_discrete_space_dual<DDim>->get_device())>>;
+    Kokkos::Array<std::byte, sizeof(device_impl_type)> previous_device;
+    std::memcpy(
+            previous_device.data(),
+            &detail::g_discrete_space_dual<DDim>->get_device(),
+            sizeof(device_impl_type));
+#endif
+    bool const in_place = detail::g_discrete_space_dual<DDim>->assign(impl);
+    if (!in_place) {
+        detail::g_discrete_space_dual<DDim>.emplace(std::move(impl));
+    }
+#if defined(__CUDACC__) || defined(__HIPCC__)
+    if (!in_place
+        || std::memcmp(
+                   previous_device.data(),
+                   &detail::g_discrete_space_dual<DDim>->get_device(),
+                   sizeof(device_impl_type))
+                   != 0) {
+        detail::copy_discrete_space_to_device<DDim>();
+    }
+#endif
+    ++detail::g_discrete_space_version<DDim>;
+}
+
+/** Move construct a replacement of a global singleton discrete space and pass through the other
+ * argument
+ *
+ * @param a - the discrete space to move at index 0
+ *          - the arguments to pass through at index 1
+ */
+template <class DDim, class DDimImpl, class Arg0>
+Arg0 reinit_discrete_space(std::tuple<DDimImpl, Arg0>&& a)
+{
+    reinit_discrete_space<DDim>(std::move(std::get<0>(a)));
+    return std::get<1>(a);
+}
+
+/** Move construct a replacement of a global singleton discrete space and pass through remaining
+ * arguments
+ *
+ * @param a - the discrete space to move at index 0
+ *          - the (2+) arguments to pass through in other indices
+ */
+template <class DDim, class DDimImpl, class Arg0, class Arg1, class... Args>
+std::tuple<Arg0, Arg1, Args...> reinit_discrete_space(
+        std::tuple<DDimImpl, Arg0, Arg1, Args...>&& a)
+{
+    reinit_discrete_space<DDim>(std::move(std::get<0>(a)));
+    return detail::extract_after(std::move(a), std::index_sequence_for<Arg0, Arg1, Args...>());
+}
+
 /**
  * @tparam DDim a discrete dimension
  * @return the discrete space instance associated with `DDim`.
@@ -229,6 +313,17 @@ bool is_discrete_space_initialized() noexcept
     return detail::g_discrete_space_dual<DDim>.has_value();
 }
 
+/** The number of times the discrete space of `DDim` was initialized or reinitialized
+ *
+ * Caches depending on the discrete space, such as factorizations or plans, can store it and
+ * compare it to the current one to detect that they are out of date.
+ */
+template <class DDim>
+std::size_t discrete_space_version() noexcept
+{
+    return detail::g_discrete_space_version<DDim>;
+}
+
 template <class DDim>
 detail::ddim_impl_t<DDim, Kokkos::HostSpace> const& host_discrete_space()
 {
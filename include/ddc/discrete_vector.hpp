@@ -5,7 +5,9 @@
 #pragma once
 
 #include <array>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <ostream>
 #include <type_traits>
 #include <utility>
@@ -46,7 +48,37 @@ struct ToTypeSeq<DiscreteVector<Tags...>>
 
 /** A DiscreteVectorElement is a scalar that represents the difference between two coordinates.
  */
+#ifdef DDC_BUILD_32BIT_INDICES
+using DiscreteVectorElement = std::int32_t;
+#else
 using DiscreteVectorElement = std::ptrdiff_t;
+#endif
+
+namespace detail {
+
+/// True if `value` is representable by the integer type `T`, always true for a non-integral value
+template <class T, class U>
+KOKKOS_FUNCTION constexpr bool in_index_range(U const value) noexcept
+{
+    if constexpr (!std::is_integral_v<U>) {
+        return true;
+    } else {
+        if constexpr (std::is_signed_v<U>) {
+            if (value < 0) {
+                if constexpr (std::is_signed_v<T>) {
+                    return static_cast<std::intmax_t>(value)
+                           >= static_cast<std::intmax_t>(Kokkos::Experimental::finite_min_v<T>);
+                } else {
+                    return false;
+                }
+            }
+        }
+        return static_cast<std::uintmax_t>(value)
+               <= static_cast<std::uintmax_t>(Kokkos::Experimental::finite_max_v<T>);
+    }
+}
+
+} // namespace detail
 
 template <class QueryTag, class... Tags>
 KOKKOS_FUNCTION constexpr DiscreteVectorElement const& get(
@@ -291,6 +323,7 @@ public:
     explicit KOKKOS_FUNCTION constexpr DiscreteVector(Params const&... params) noexcept
         : m_values {static_cast<DiscreteVectorElement>(params)...}
     {
+        assert((detail::in_index_range<DiscreteVectorElement>(params) && ...));
     }
 
     KOKKOS_DEFAULTED_FUNCTION ~DiscreteVector() = default;
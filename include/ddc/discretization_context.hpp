@@ -0,0 +1,208 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc/detail/dual_discretization.hpp"
+#include "ddc/discrete_space.hpp"
+
+namespace ddc {
+
+/// Identifies an instance of the discrete space of `DDim` held by a `DiscretizationContext`
+template <class DDim>
+class DiscretizationHandle
+{
+    std::size_t m_id = 0;
+
+public:
+    DiscretizationHandle() = default;
+
+    KOKKOS_FUNCTION explicit constexpr DiscretizationHandle(std::size_t const id) noexcept
+        : m_id(id)
+    {
+    }
+
+    KOKKOS_FUNCTION constexpr std::size_t id() const noexcept
+    {
+        return m_id;
+    }
+
+    KOKKOS_FUNCTION friend constexpr bool operator==(
+            DiscretizationHandle const& lhs,
+            DiscretizationHandle const& rhs) noexcept
+    {
+        return lhs.m_id == rhs.m_id;
+    }
+
+    KOKKOS_FUNCTION friend constexpr bool operator!=(
+            DiscretizationHandle const& lhs,
+            DiscretizationHandle const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+/** A view on the instances of a `DiscretizationContext` usable in kernels.
+ *
+ * It is a shallow copy, it remains valid as long as the context is alive.
+ */
+template <class DDim>
+class DiscretizationContextView
+{
+public:
+    using memory_space = typename detail::DualDiscretization<DDim>::device_memory_space;
+
+    using discrete_space_type = detail::ddim_impl_t<DDim, memory_space>;
+
+    /// The storage of the instances, each bitwise copied in a `gpu_proxy`
+    using instances_type = Kokkos::View<detail::gpu_proxy<discrete_space_type>*, memory_space>;
+
+private:
+    instances_type m_instances;
+
+public:
+    DiscretizationContextView() = default;
+
+    explicit DiscretizationContextView(instances_type instances)
+        : m_instances(std::move(instances))
+    {
+    }
+
+    KOKKOS_FUNCTION std::size_t size() const noexcept
+    {
+        return m_instances.size();
+    }
+
+    /** The instance identified by `handle`
+     * This function must be called from a kernel.
+     */
+    KOKKOS_FUNCTION discrete_space_type const& operator[](
+            DiscretizationHandle<DDim> const& handle) const
+    {
+        assert(handle.id() < size());
+        return *m_instances(handle.id());
+    }
+};
+
+/** A container of several instances of the discrete space of `DDim`.
+ *
+ * Unlike `init_discrete_space` that initializes the single global instance of `DDim`, each
+ * instance added to a context is identified by a `DiscretizationHandle`. The kernels select the
+ * instance of each iteration from a `DiscretizationContextView`, so that the members of an
+ * ensemble, e.g. a parameter scan over meshes, are processed by a single kernel launch.
+ * The functions relying on the global instance, such as `ddc::coordinate`, are replaced by the
+ * member functions of the selected instance.
+ */
+template <class DDim>
+class DiscretizationContext
+{
+public:
+    using memory_space = typename DiscretizationContextView<DDim>::memory_space;
+
+    using host_discrete_space_type = detail::ddim_impl_t<DDim, Kokkos::HostSpace>;
+
+    using discrete_space_type = typename DiscretizationContextView<DDim>::discrete_space_type;
+
+    using view_type = DiscretizationContextView<DDim>;
+
+private:
+    // A deque never moves its elements, the device instances keep referring to valid data
+    std::deque<detail::DualDiscretization<DDim>> m_instances;
+
+    typename view_type::instances_type m_device_instances;
+
+    bool m_synchronized = true;
+
+public:
+    DiscretizationContext() = default;
+
+    DiscretizationContext(DiscretizationContext const& x) = delete;
+
+    DiscretizationContext(DiscretizationContext&& x) = default;
+
+    ~DiscretizationContext() = default;
+
+    DiscretizationContext& operator=(DiscretizationContext const& x) = delete;
+
+    DiscretizationContext& operator=(DiscretizationContext&& x) = default;
+
+    /** Adds an instance of the discrete space constructed from `args`
+     * @param args the constructor arguments, as for `init_discrete_space`
+     * @return the handle of the new instance
+     */
+    template <class... Args>
+    DiscretizationHandle<DDim> emplace(Args&&... args)
+    {
+        m_instances.emplace_back(std::forward<Args>(args)...);
+        m_synchronized = false;
+        return DiscretizationHandle<DDim>(m_instances.size() - 1);
+    }
+
+    /** Moves the discrete space at index 0 into a new instance and passes through the other
+     * elements, as for `init_discrete_space`
+     * @param a the tuple returned by the `init` functions of a discretization
+     * @return the handle of the new instance and the passed through elements
+     */
+    template <class DDimImpl, class... Args>
+    std::tuple<DiscretizationHandle<DDim>, Args...> emplace(std::tuple<DDimImpl, Args...>&& a)
+    {
+        DiscretizationHandle<DDim> const handle = emplace(std::move(std::get<0>(a)));
+        return std::tuple_cat(
+                std::make_tuple(handle),
+                detail::extract_after(std::move(a), std::index_sequence_for<Args...>()));
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_instances.size();
+    }
+
+    /// The host instance identified by `handle`
+    host_discrete_space_type const& host(DiscretizationHandle<DDim> const& handle) const
+    {
+        assert(handle.id() < size());
+        return m_instances[handle.id()].get_host();
+    }
+
+    /** A view on the instances for the kernels
+     *
+     * The instances added since the previous call are copied to the device, the views returned
+     * before do not see them.
+     */
+    view_type view()
+    {
+        if (!m_synchronized) {
+            m_device_instances = typename view_type::instances_type(
+                    Kokkos::view_alloc(
+                            Kokkos::WithoutInitializing,
+                            std::string("ddc_discretization_context_") + typeid(DDim).name()),
+                    m_instances.size());
+            auto const device_instances_host = Kokkos::create_mirror_view(m_device_instances);
+            // The instances are bitwise copied like in `init_discrete_space`, the context keeps
+            // owning their data
+            for (std::size_t i = 0; i < m_instances.size(); ++i) {
+                std::memcpy(
+                        static_cast<void*>(device_instances_host(i).data()),
+                        static_cast<void const*>(&m_instances[i].get_device()),
+                        sizeof(discrete_space_type));
+            }
+            Kokkos::deep_copy(m_device_instances, device_instances_host);
+            m_synchronized = true;
+        }
+        return view_type(m_device_instances);
+    }
+};
+
+} // namespace ddc
@@ -0,0 +1,713 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc/detail/kokkos.hpp"
+#include "ddc/detail/type_seq.hpp"
+#include "ddc/discrete_domain.hpp"
+#include "ddc/discrete_element.hpp"
+#include "ddc/discrete_vector.hpp"
+#include "ddc/for_each.hpp"
+#include "ddc/multi_patch.hpp"
+#include "ddc/parallel_for_each.hpp"
+
+namespace ddc::experimental {
+
+/// Element of the level `l + 1` index space at the lower corner of the refined `delem` of level `l`
+template <class... DDims>
+KOKKOS_FUNCTION DiscreteElement<DDims...> refine(
+        DiscreteElement<DDims...> const& delem,
+        std::size_t const ratio)
+{
+    return DiscreteElement<DDims...>((uid<DDims>(delem) * ratio)...);
+}
+
+/// Element of the level `l` index space containing `delem` of level `l + 1`
+template <class... DDims>
+KOKKOS_FUNCTION DiscreteElement<DDims...> coarsen(
+        DiscreteElement<DDims...> const& delem,
+        std::size_t const ratio)
+{
+    return DiscreteElement<DDims...>((uid<DDims>(delem) / ratio)...);
+}
+
+/// The box of the level `l + 1` index space covering `domain` of level `l`
+template <class... DDims>
+KOKKOS_FUNCTION DiscreteDomain<DDims...> refine(
+        DiscreteDomain<DDims...> const& domain,
+        std::size_t const ratio)
+{
+    return DiscreteDomain<DDims...>(
+            refine(domain.front(), ratio),
+            DiscreteVector<DDims...>(static_cast<DiscreteVectorElement>(
+                    domain.template extent<DDims>().value() * ratio)...));
+}
+
+/// The smallest box of the level `l` index space covering `domain` of level `l + 1`
+template <class... DDims>
+KOKKOS_FUNCTION DiscreteDomain<DDims...> coarsen(
+        DiscreteDomain<DDims...> const& domain,
+        std::size_t const ratio)
+{
+    DiscreteElement<DDims...> const front = coarsen(domain.front(), ratio);
+    return DiscreteDomain<DDims...>(
+            front,
+            DiscreteVector<DDims...>(static_cast<DiscreteVectorElement>(
+                    (uid<DDims>(domain.back()) / ratio) - uid<DDims>(front) + 1)...));
+}
+
+} // namespace ddc::experimental
+
+namespace ddc::detail {
+
+/// `value` for each type of a pack expansion
+template <class T>
+KOKKOS_FUNCTION constexpr DiscreteVectorElement repeat_value(
+        DiscreteVectorElement const value) noexcept
+{
+    return value;
+}
+
+template <class... DDims>
+DiscreteDomain<DDims...> intersect_boxes(
+        DiscreteDomain<DDims...> const& lhs,
+        DiscreteDomain<DDims...> const& rhs)
+{
+    DiscreteElement<DDims...> const front(
+            std::max(uid<DDims>(lhs.front()), uid<DDims>(rhs.front()))...);
+    DiscreteElement<DDims...> const back(
+            std::min(uid<DDims>(lhs.back()), uid<DDims>(rhs.back()))...);
+    if (((uid<DDims>(back) < uid<DDims>(front)) || ...)) {
+        return DiscreteDomain<DDims...>(
+                front,
+                DiscreteVector<DDims...>(repeat_value<DDims>(0)...));
+    }
+    return DiscreteDomain<DDims...>(
+            front,
+            back - front + DiscreteVector<DDims...>(repeat_value<DDims>(1)...));
+}
+
+/// `box` with its range along `DDim` replaced by `[front, back]`
+template <class DDim, class... DDims>
+DiscreteDomain<DDims...> with_range(
+        DiscreteDomain<DDims...> const& box,
+        DiscreteElementType const front,
+        DiscreteElementType const back)
+{
+    return DiscreteDomain<DDims...>(
+            DiscreteElement<DDims...>(
+                    (std::is_same_v<DDims, DDim> ? front : uid<DDims>(box.front()))...),
+            DiscreteVector<DDims...>(
+                    (std::is_same_v<DDims, DDim>
+                             ? static_cast<DiscreteVectorElement>(back + 1 - front)
+                             : box.template extent<DDims>().value())...));
+}
+
+/// Moves the slabs of `rest` before and after `hole` along `DDim` to `pieces`
+template <class DDim, class... DDims>
+void peel_box(
+        DiscreteDomain<DDims...>& rest,
+        DiscreteDomain<DDims...> const& hole,
+        std::vector<DiscreteDomain<DDims...>>& pieces)
+{
+    DiscreteElementType const front = uid<DDim>(rest.front());
+    DiscreteElementType const back = uid<DDim>(rest.back());
+    DiscreteElementType const hole_front = uid<DDim>(hole.front());
+    DiscreteElementType const hole_back = uid<DDim>(hole.back());
+    if (front < hole_front) {
+        pieces.push_back(with_range<DDim>(rest, front, hole_front - 1));
+    }
+    if (hole_back < back) {
+        pieces.push_back(with_range<DDim>(rest, hole_back + 1, back));
+    }
+    rest = with_range<DDim>(rest, hole_front, hole_back);
+}
+
+/// Disjoint boxes covering the elements of `box` that are not in `hole`
+template <class... DDims>
+std::vector<DiscreteDomain<DDims...>> subtract_boxes(
+        DiscreteDomain<DDims...> const& box,
+        DiscreteDomain<DDims...> const& hole)
+{
+    DiscreteDomain<DDims...> const overlap = intersect_boxes(box, hole);
+    if (overlap.empty()) {
+        return {box};
+    }
+    std::vector<DiscreteDomain<DDims...>> pieces;
+    DiscreteDomain<DDims...> rest = box;
+    (peel_box<DDims>(rest, overlap, pieces), ...);
+    return pieces;
+}
+
+/// The domain made of the single element `delem`
+template <class... DDims>
+KOKKOS_FUNCTION DiscreteDomain<DDims...> unit_box(DiscreteElement<DDims...> const& delem)
+{
+    return DiscreteDomain<DDims...>(delem, DiscreteVector<DDims...>(repeat_value<DDims>(1)...));
+}
+
+/// Cells of a coarse patch covered by a fine patch
+template <class... DDims>
+struct AmrTransfer
+{
+    std::size_t coarse_patch;
+
+    std::size_t fine_patch;
+
+    /// The covered box, in the coarse index space
+    DiscreteDomain<DDims...> coarse_box;
+
+    /// Index of the first point of the transfer in the points of all the transfers
+    std::size_t offset;
+};
+
+/// The transfers between two consecutive levels, numbered by coarse and by fine points
+template <class... DDims>
+struct AmrLevelTransfers
+{
+    DualTable<AmrTransfer<DDims...>> restrictions;
+
+    std::size_t restriction_size = 0;
+
+    DualTable<AmrTransfer<DDims...>> prolongations;
+
+    std::size_t prolongation_size = 0;
+};
+
+/// Sets the flag of the tiles holding a flagged point, with atomic stores
+template <class FlagSpan, class TileTable>
+class AmrTagTilesKokkosFunctor
+{
+    FlagSpan m_flags;
+
+    TileTable m_tiles;
+
+    Kokkos::View<int*, typename TileTable::memory_space> m_tile_flags;
+
+    std::size_t m_blocking_factor;
+
+public:
+    AmrTagTilesKokkosFunctor(
+            FlagSpan const& flags,
+            TileTable const& tiles,
+            Kokkos::View<int*, typename TileTable::memory_space> const& tile_flags,
+            std::size_t const blocking_factor)
+        : m_flags(flags)
+        , m_tiles(tiles)
+        , m_tile_flags(tile_flags)
+        , m_blocking_factor(blocking_factor)
+    {
+    }
+
+    template <class DElem>
+    KOKKOS_FUNCTION void operator()(std::size_t const p, DElem const& delem) const
+    {
+        if (m_flags(p, delem)) {
+            // Several flagged elements of a tile may store its flag concurrently
+            Kokkos::atomic_store(
+                    &m_tile_flags(
+                            m_tiles(p).offset
+                            + linear_index(
+                                    m_tiles(p).domain,
+                                    experimental::coarsen(delem, m_blocking_factor))),
+                    1);
+        }
+    }
+};
+
+template <class CoarseSpan, class FineSpan, class TransferTable>
+class AmrProlongateKokkosFunctor
+{
+    CoarseSpan m_coarse;
+
+    FineSpan m_fine;
+
+    TransferTable m_transfers;
+
+    std::size_t m_ratio;
+
+public:
+    AmrProlongateKokkosFunctor(
+            CoarseSpan const& coarse,
+            FineSpan const& fine,
+            TransferTable const& transfers,
+            std::size_t const ratio)
+        : m_coarse(coarse)
+        , m_fine(fine)
+        , m_transfers(transfers)
+        , m_ratio(ratio)
+    {
+    }
+
+    KOKKOS_FUNCTION void operator()(std::size_t const i) const
+    {
+        auto const& transfer = m_transfers(find_entry(m_transfers, i));
+        auto const fine_elem = element_at(
+                experimental::refine(transfer.coarse_box, m_ratio),
+                i - transfer.offset);
+        m_fine(transfer.fine_patch, fine_elem)
+                = m_coarse(transfer.coarse_patch, experimental::coarsen(fine_elem, m_ratio));
+    }
+};
+
+template <class FineSpan, class CoarseSpan, class TransferTable>
+class AmrAverageDownKokkosFunctor
+{
+    FineSpan m_fine;
+
+    CoarseSpan m_coarse;
+
+    TransferTable m_transfers;
+
+    std::size_t m_ratio;
+
+public:
+    AmrAverageDownKokkosFunctor(
+            FineSpan const& fine,
+            CoarseSpan const& coarse,
+            TransferTable const& transfers,
+            std::size_t const ratio)
+        : m_fine(fine)
+        , m_coarse(coarse)
+        , m_transfers(transfers)
+        , m_ratio(ratio)
+    {
+    }
+
+    KOKKOS_FUNCTION void operator()(std::size_t const i) const
+    {
+        using value_type = std::remove_const_t<typename CoarseSpan::element_type>;
+        auto const& transfer = m_transfers(find_entry(m_transfers, i));
+        auto const coarse_elem
+                = element_at(transfer.coarse_box, i - transfer.offset);
+        auto const children = experimental::refine(unit_box(coarse_elem), m_ratio);
+        value_type sum = m_fine(transfer.fine_patch, children.front());
+        for (std::size_t k = 1; k < children.size(); ++k) {
+            sum += m_fine(transfer.fine_patch, element_at(children, k));
+        }
+        m_coarse(transfer.coarse_patch, coarse_elem)
+                = sum / static_cast<value_type>(children.size());
+    }
+};
+
+} // namespace ddc::detail
+
+namespace ddc::experimental {
+
+/** Experimental block-structured hierarchy of refined patches.
+ *
+ * Each level is a `MultiPatchDomain` in its own index space, the index space of the level `l + 1`
+ * being the one of the level `l` refined by the same integer ratio in all the dimensions. The
+ * values of a level are stored in a `MultiPatchChunk` on `level(l)` and iterated in a single launch
+ * with `parallel_for_each(hierarchy.level(l), f)`.
+ *
+ * The patches of a level are aligned on the cells of the coarser level and nested in its patches,
+ * so that the transfers between two levels, precomputed when a level is set, are each applied by a
+ * single kernel: `prolongate` injects the coarse values into the fine cells (piecewise constant)
+ * and `average_down` replaces the covered coarse values by the average of their fine cells.
+ * Where patches of a level overlap, the overlapping values are expected to be equal and the
+ * transfers write them from a single patch.
+ */
+template <class... DDims>
+class AmrHierarchy
+{
+public:
+    using discrete_domain_type = DiscreteDomain<DDims...>;
+
+    using discrete_element_type = DiscreteElement<DDims...>;
+
+    using level_type = MultiPatchDomain<DDims...>;
+
+private:
+    using transfer_type = detail::AmrTransfer<DDims...>;
+
+    std::size_t m_ratio;
+
+    std::vector<level_type> m_levels;
+
+    /// `m_transfers[l]` holds the transfers between the levels `l` and `l + 1`
+    std::vector<detail::AmrLevelTransfers<DDims...>> m_transfers;
+
+    /// The vector of `length` along the last dimension and of `other` along the others
+    static DiscreteVector<DDims...> along_last(
+            DiscreteVectorElement const length,
+            DiscreteVectorElement const other)
+    {
+        constexpr std::size_t last = sizeof...(DDims) - 1;
+        return DiscreteVector<DDims...>(
+                (type_seq_rank_v<DDims, detail::TypeSeq<DDims...>> == last ? length
+                                                                                 : other)...);
+    }
+
+    static bool is_covered(level_type const& level, discrete_domain_type const& box)
+    {
+        bool covered = true;
+        ddc::for_each(box, [&](discrete_element_type const delem) {
+            bool found = false;
+            for (std::size_t p = 0; p < level.nb_patches() && !found; ++p) {
+                found = detail::contains(level.patch(p), delem);
+            }
+            covered = covered && found;
+        });
+        return covered;
+    }
+
+    /// The disjoint parts of `box` not in the boxes of `claimed`, appended to `claimed`
+    static std::vector<discrete_domain_type> claim(
+            std::vector<discrete_domain_type>& claimed,
+            discrete_domain_type const& box)
+    {
+        std::vector<discrete_domain_type> pieces {box};
+        for (discrete_domain_type const& other : claimed) {
+            std::vector<discrete_domain_type> remaining;
+            for (discrete_domain_type const& piece : pieces) {
+                std::vector<discrete_domain_type> const parts
+                        = detail::subtract_boxes(piece, other);
+                remaining.insert(remaining.end(), parts.begin(), parts.end());
+            }
+            pieces = std::move(remaining);
+        }
+        claimed.insert(claimed.end(), pieces.begin(), pieces.end());
+        return pieces;
+    }
+
+    /** The transfers between two levels, each coarse value of a coarse patch being restricted by
+     * a single transfer and each fine value of a fine patch being prolongated by a single transfer
+     * when the patches overlap, so that the kernels never write an element twice
+     */
+    detail::AmrLevelTransfers<DDims...> make_transfers(
+            level_type const& coarse,
+            level_type const& fine) const
+    {
+        std::vector<transfer_type> restrictions;
+        std::vector<transfer_type> prolongations;
+        detail::AmrLevelTransfers<DDims...> transfers;
+        // The coarse boxes already restricted in each coarse patch
+        std::vector<std::vector<discrete_domain_type>> restricted(coarse.nb_patches());
+        for (std::size_t pf = 0; pf < fine.nb_patches(); ++pf) {
+            discrete_domain_type const covered = coarsen(fine.patch(pf), m_ratio);
+            // The coarse boxes already prolongated in the fine patch
+            std::vector<discrete_domain_type> prolongated;
+            for (std::size_t pc = 0; pc < coarse.nb_patches(); ++pc) {
+                discrete_domain_type const box
+                        = detail::intersect_boxes(covered, coarse.patch(pc));
+                if (box.empty()) {
+                    continue;
+                }
+                for (discrete_domain_type const& piece : claim(restricted[pc], box)) {
+                    restrictions.push_back(
+                            transfer_type {pc, pf, piece, transfers.restriction_size});
+                    transfers.restriction_size += piece.size();
+                }
+                for (discrete_domain_type const& piece : claim(prolongated, box)) {
+                    prolongations.push_back(
+                            transfer_type {pc, pf, piece, transfers.prolongation_size});
+                    transfers.prolongation_size += refine(piece, m_ratio).size();
+                }
+            }
+        }
+        transfers.restrictions
+                = detail::DualTable<transfer_type>("ddc_amr_restrictions", restrictions);
+        transfers.prolongations
+                = detail::DualTable<transfer_type>("ddc_amr_prolongations", prolongations);
+        return transfers;
+    }
+
+    /** The patches of the level `l + 1` covering the flagged tiles of the patches of the level `l`,
+     * each run of consecutive flagged tiles along the last dimension giving a single patch
+     */
+    std::vector<discrete_domain_type> make_patches(
+            std::size_t const l,
+            level_type const& tiles,
+            Kokkos::View<int*, Kokkos::HostSpace> const& tile_flags,
+            std::size_t const blocking_factor) const
+    {
+        std::vector<discrete_domain_type> patches;
+        auto const add_patch = [&](std::size_t const p,
+                                   discrete_element_type const& front,
+                                   DiscreteVectorElement const length) {
+            DiscreteVector<DDims...> const extents = along_last(length, 1);
+            discrete_domain_type const patch = refine(
+                    detail::intersect_boxes(
+                            refine(discrete_domain_type(front, extents), blocking_factor),
+                            m_levels[l].patch(p)),
+                    m_ratio);
+            bool duplicated = false;
+            for (discrete_domain_type const& other : patches) {
+                duplicated = duplicated || (other == patch);
+            }
+            if (!duplicated) {
+                patches.push_back(patch);
+            }
+        };
+        for (std::size_t p = 0; p < tiles.nb_patches(); ++p) {
+            discrete_domain_type const patch_tiles = tiles.patch(p);
+            discrete_element_type run_front = patch_tiles.front();
+            DiscreteVectorElement run_length = 0;
+            ddc::for_each(patch_tiles, [&](discrete_element_type const it) {
+                bool const flagged
+                        = tile_flags(tiles.offset(p) + detail::linear_index(patch_tiles, it))
+                          != 0;
+                bool const extends_run = it == run_front + along_last(run_length, 0);
+                if (run_length > 0 && !(flagged && extends_run)) {
+                    add_patch(p, run_front, run_length);
+                    run_length = 0;
+                }
+                if (flagged) {
+                    if (run_length == 0) {
+                        run_front = it;
+                    }
+                    ++run_length;
+                }
+            });
+            if (run_length > 0) {
+                add_patch(p, run_front, run_length);
+            }
+        }
+        return patches;
+    }
+
+public:
+    /** Builds a hierarchy with a single level
+     * @param coarsest the patches of the level 0
+     * @param ratio the refinement ratio between two consecutive levels
+     */
+    AmrHierarchy(level_type coarsest, std::size_t const ratio)
+        : m_ratio(ratio)
+        , m_levels {std::move(coarsest)}
+    {
+        if (m_ratio < 2) {
+            throw std::runtime_error("The refinement ratio must be at least 2");
+        }
+    }
+
+    /** Builds a hierarchy with a single level made of a single patch
+     * @param coarsest the domain of the level 0
+     * @param ratio the refinement ratio between two consecutive levels
+     */
+    AmrHierarchy(discrete_domain_type const& coarsest, std::size_t const ratio)
+        : AmrHierarchy(level_type(std::vector<discrete_domain_type> {coarsest}), ratio)
+    {
+    }
+
+    std::size_t ratio() const noexcept
+    {
+        return m_ratio;
+    }
+
+    std::size_t nb_levels() const noexcept
+    {
+        return m_levels.size();
+    }
+
+    level_type const& level(std::size_t const l) const
+    {
+        assert(l < nb_levels());
+        return m_levels[l];
+    }
+
+    /** Replaces the level `l` and removes the finer levels
+     * @param l the level, between 1 and `nb_levels()`
+     * @param patches the patches in the index space of the level `l`, aligned on the cells of the
+     * level `l - 1` and covered by its patches
+     */
+    void set_level(std::size_t const l, std::vector<discrete_domain_type> const& patches)
+    {
+        assert(l >= 1 && l <= nb_levels());
+        level_type const& coarse = m_levels[l - 1];
+        for (discrete_domain_type const& patch : patches) {
+            if (refine(coarsen(patch, m_ratio), m_ratio) != patch) {
+                throw std::runtime_error(
+                        "The patch is not aligned on the cells of the coarser level");
+            }
+            if (!is_covered(coarse, coarsen(patch, m_ratio))) {
+                throw std::runtime_error(
+                        "The patch is not nested in the patches of the coarser level");
+            }
+        }
+        m_levels.resize(l);
+        m_transfers.resize(l - 1);
+        if (!patches.empty()) {
+            m_levels.emplace_back(patches);
+            m_transfers.push_back(make_transfers(m_levels[l - 1], m_levels[l]));
+        }
+    }
+
+    /** Replaces the level `l + 1` by patches covering the flagged points of the level `l`
+     *
+     * The patches of the level `l` are split in tiles of `blocking_factor` points, aligned on the
+     * multiples of `blocking_factor` in each dimension, and the tiles having a flagged point are
+     * refined. The tiles are tagged on the device, only the tile flags are copied to the host.
+     * The finer levels are removed, and the level `l + 1` too if no point is flagged.
+     * @param[in] execution_space a Kokkos execution space where the tiles are tagged
+     * @param[in] l the flagged level
+     * @param[in] flags a span on the level `l` of values converting to `true` where to refine
+     * @param[in] blocking_factor the size of the tiles
+     */
+    template <class ExecSpace, class ElementType, class MemorySpace>
+    void regrid(
+            ExecSpace const& execution_space,
+            std::size_t const l,
+            MultiPatchSpan<ElementType, level_type, MemorySpace> const& flags,
+            std::size_t const blocking_factor)
+    {
+        assert(l < nb_levels());
+        assert(flags.nb_patches() == m_levels[l].nb_patches());
+        if (blocking_factor == 0) {
+            throw std::runtime_error("The blocking factor must be at least 1");
+        }
+        std::vector<discrete_domain_type> tile_patches;
+        for (std::size_t p = 0; p < m_levels[l].nb_patches(); ++p) {
+            tile_patches.push_back(coarsen(m_levels[l].patch(p), blocking_factor));
+        }
+        level_type const tiles(tile_patches);
+        auto const tile_table = tiles.template patches<ExecSpace>();
+        using tile_table_type = std::remove_const_t<decltype(tile_table)>;
+        Kokkos::View<int*, typename tile_table_type::memory_space> const tile_flags(
+                "ddc_amr_tile_flags",
+                tiles.size());
+        parallel_for_each(
+                "ddc_amr_tag_tiles",
+                execution_space,
+                m_levels[l],
+                detail::AmrTagTilesKokkosFunctor<
+                        MultiPatchSpan<ElementType, level_type, MemorySpace>,
+                        tile_table_type>(flags, tile_table, tile_flags, blocking_factor));
+        auto const tile_flags_host
+                = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tile_flags);
+        set_level(l + 1, make_patches(l, tiles, tile_flags_host, blocking_factor));
+    }
+
+    /** Replaces the level `l + 1` by patches covering the flagged points of the level `l` using
+     * the `Kokkos` default execution space
+     * @param[in] l the flagged level
+     * @param[in] flags a span on the level `l` of values converting to `true` where to refine
+     * @param[in] blocking_factor the size of the tiles
+     */
+    template <class ElementType, class MemorySpace>
+    void regrid(
+            std::size_t const l,
+            MultiPatchSpan<ElementType, level_type, MemorySpace> const& flags,
+            std::size_t const blocking_factor)
+    {
+        regrid(Kokkos::DefaultExecutionSpace(), l, flags, blocking_factor);
+    }
+
+    /** Fills the level `l + 1` with the values of the level `l` of the cells containing its points
+     * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+     * @param[in] l the coarse level
+     * @param[in] coarse a span on the level `l`
+     * @param[out] fine a span on the level `l + 1`
+     */
+    template <
+            class ExecSpace,
+            class CoarseElementType,
+            class FineElementType,
+            class MemorySpace,
+            std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>, bool> = true>
+    void prolongate(
+            ExecSpace const& execution_space,
+            std::size_t const l,
+            MultiPatchSpan<CoarseElementType, level_type, MemorySpace> const& coarse,
+            MultiPatchSpan<FineElementType, level_type, MemorySpace> const& fine) const
+    {
+        assert(l + 1 < nb_levels());
+        detail::AmrLevelTransfers<DDims...> const& transfers = m_transfers[l];
+        if (transfers.prolongation_size == 0) {
+            return;
+        }
+        auto const table = transfers.prolongations.template get<ExecSpace>();
+        Kokkos::parallel_for(
+                "ddc_amr_prolongate",
+                Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<std::size_t>>(
+                        execution_space,
+                        0,
+                        transfers.prolongation_size),
+                detail::AmrProlongateKokkosFunctor<
+                        MultiPatchSpan<CoarseElementType, level_type, MemorySpace>,
+                        MultiPatchSpan<FineElementType, level_type, MemorySpace>,
+                        std::remove_const_t<decltype(table)>>(coarse, fine, table, m_ratio));
+    }
+
+    /** Fills the level `l + 1` with the values of the level `l` of the cells containing its points
+     * using the `Kokkos` default execution space
+     * @param[in] l the coarse level
+     * @param[in] coarse a span on the level `l`
+     * @param[out] fine a span on the level `l + 1`
+     */
+    template <class CoarseElementType, class FineElementType, class MemorySpace>
+    void prolongate(
+            std::size_t const l,
+            MultiPatchSpan<CoarseElementType, level_type, MemorySpace> const& coarse,
+            MultiPatchSpan<FineElementType, level_type, MemorySpace> const& fine) const
+    {
+        prolongate(Kokkos::DefaultExecutionSpace(), l, coarse, fine);
+    }
+
+    /** Replaces the values of the level `l` covered by the level `l + 1` by the average of the
+     * values of their fine points
+     * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+     * @param[in] l the coarse level
+     * @param[in] fine a span on the level `l + 1`
+     * @param[inout] coarse a span on the level `l`
+     */
+    template <
+            class ExecSpace,
+            class FineElementType,
+            class CoarseElementType,
+            class MemorySpace,
+            std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>, bool> = true>
+    void average_down(
+            ExecSpace const& execution_space,
+            std::size_t const l,
+            MultiPatchSpan<FineElementType, level_type, MemorySpace> const& fine,
+            MultiPatchSpan<CoarseElementType, level_type, MemorySpace> const& coarse) const
+    {
+        assert(l + 1 < nb_levels());
+        detail::AmrLevelTransfers<DDims...> const& transfers = m_transfers[l];
+        if (transfers.restriction_size == 0) {
+            return;
+        }
+        auto const table = transfers.restrictions.template get<ExecSpace>();
+        Kokkos::parallel_for(
+                "ddc_amr_average_down",
+                Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<std::size_t>>(
+                        execution_space,
+                        0,
+                        transfers.restriction_size),
+                detail::AmrAverageDownKokkosFunctor<
+                        MultiPatchSpan<FineElementType, level_type, MemorySpace>,
+                        MultiPatchSpan<CoarseElementType, level_type, MemorySpace>,
+                        std::remove_const_t<decltype(table)>>(fine, coarse, table, m_ratio));
+    }
+
+    /** Replaces the values of the level `l` covered by the level `l + 1` by the average of the
+     * values of their fine points using the `Kokkos` default execution space
+     * @param[in] l the coarse level
+     * @param[in] fine a span on the level `l + 1`
+     * @param[inout] coarse a span on the level `l`
+     */
+    template <class FineElementType, class CoarseElementType, class MemorySpace>
+    void average_down(
+            std::size_t const l,
+            MultiPatchSpan<FineElementType, level_type, MemorySpace> const& fine,
+            MultiPatchSpan<CoarseElementType, level_type, MemorySpace> const& coarse) const
+    {
+        average_down(Kokkos::DefaultExecutionSpace(), l, fine, coarse);
+    }
+};
+
+} // namespace ddc::experimental
@@ -0,0 +1,138 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cassert>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc/chunk_traits.hpp"
+#include "ddc/coordinate.hpp"
+#include "ddc/discrete_domain.hpp"
+#include "ddc/discrete_element.hpp"
+#include "ddc/mapped_sampling.hpp"
+#include "ddc/non_uniform_point_sampling.hpp"
+#include "ddc/parallel_for_each.hpp"
+#include "ddc/periodic_sampling.hpp"
+#include "ddc/uniform_point_sampling.hpp"
+
+namespace ddc {
+
+/** Index of the cell of a domain containing a position
+ * @param[in] domain a domain of at least two points
+ * @param[in] x the position
+ * @return the element `i` of `domain` such that \f$x_i \le x < x_{i+1}\f$, the positions outside
+ * of the domain being attributed to its first or last cell
+ */
+template <class DDim>
+KOKKOS_FUNCTION DiscreteElement<DDim> find_cell(
+        DiscreteDomain<DDim> const& domain,
+        Coordinate<typename DDim::continuous_dimension_type> const& x)
+{
+    assert(domain.size() >= 2);
+    DiscreteElement<DDim> const first_cell = domain.front();
+    DiscreteElement<DDim> const last_cell = domain.back() - 1;
+    if (x <= coordinate(first_cell)) {
+        return first_cell;
+    }
+    if (x >= coordinate(last_cell)) {
+        return last_cell;
+    }
+    DiscreteElement<DDim> const icell = find_cell<DDim>(x);
+    return icell < first_cell ? first_cell : icell > last_cell ? last_cell : icell;
+}
+
+namespace detail {
+
+template <class DDim, class CellsSpan, class CoordsSpan>
+class FindCellKokkosFunctor
+{
+    DiscreteDomain<DDim> m_domain;
+
+    CellsSpan m_cells;
+
+    CoordsSpan m_coords;
+
+public:
+    FindCellKokkosFunctor(
+            DiscreteDomain<DDim> const& domain,
+            CellsSpan const& cells,
+            CoordsSpan const& coords)
+        : m_domain(domain)
+        , m_cells(cells)
+        , m_coords(coords)
+    {
+    }
+
+    template <class Index>
+    KOKKOS_FUNCTION void operator()(Index const& i) const
+    {
+        m_cells(i) = find_cell(m_domain, m_coords(i));
+    }
+};
+
+} // namespace detail
+
+/** Locates a batch of positions in the cells of a domain, e.g. particles on a mesh
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] domain the domain whose cells are searched
+ * @param[out] cells the borrowed chunk receiving the cell of each position
+ * @param[in] coords the borrowed chunk of positions, on the domain of `cells`
+ * @return cells as a ChunkSpan
+ */
+template <class ExecSpace, class DDim, class ChunkCells, class ChunkCoords>
+auto parallel_find_cell(
+        ExecSpace const& execution_space,
+        DiscreteDomain<DDim> const& domain,
+        ChunkCells&& cells,
+        ChunkCoords&& coords)
+{
+    static_assert(is_borrowed_chunk_v<ChunkCells>);
+    static_assert(is_borrowed_chunk_v<ChunkCoords>);
+    static_assert(
+            std::is_assignable_v<chunk_reference_t<ChunkCells>, DiscreteElement<DDim>>,
+            "Not assignable");
+    static_assert(
+            Kokkos::SpaceAccessibility<
+                    ExecSpace,
+                    typename std::remove_reference_t<ChunkCells>::memory_space>::accessible,
+            "cells is not accessible from the execution space");
+    assert(cells.domain() == coords.domain());
+    auto const cells_span = cells.span_view();
+    auto const coords_span = coords.span_cview();
+    parallel_for_each(
+            "ddc_find_cell",
+            execution_space,
+            cells_span.domain(),
+            detail::FindCellKokkosFunctor<
+                    DDim,
+                    std::remove_const_t<decltype(cells_span)>,
+                    std::remove_const_t<decltype(coords_span)>>(domain, cells_span, coords_span));
+    return cells_span;
+}
+
+/** Locates a batch of positions in the cells of a domain using the default execution space
+ * @param[in] domain the domain whose cells are searched
+ * @param[out] cells the borrowed chunk receiving the cell of each position
+ * @param[in] coords the borrowed chunk of positions, on the domain of `cells`
+ * @return cells as a ChunkSpan
+ */
+template <class DDim, class ChunkCells, class ChunkCoords>
+auto parallel_find_cell(
+        DiscreteDomain<DDim> const& domain,
+        ChunkCells&& cells,
+        ChunkCoords&& coords)
+{
+    return parallel_find_cell(
+            Kokkos::DefaultExecutionSpace(),
+            domain,
+            std::forward<ChunkCells>(cells),
+            std::forward<ChunkCoords>(coords));
+}
+
+} // namespace ddc
@@ -9,6 +9,8 @@
 #include <type_traits>
 #include <utility>
 
+#include <experimental/mdspan>
+
 #include <Kokkos_Core.hpp>
 
 #include "ddc/chunk_span.hpp"
@@ -32,6 +34,18 @@ void for_each_serial(
     if constexpr (I == N) {
         f(RetType(is...));
     } else {
+        using ddim = type_seq_element_t<I, to_type_seq_t<RetType>>;
+        static constexpr std::size_t static_extent = static_extent_v<ddim>;
+        if constexpr (static_extent != std::experimental::dynamic_extent) {
+            // The compile-time trip count lets the compiler fully unroll the loop, a subdomain of
+            // the dimension takes the dynamic loop
+            if (end[I] - begin[I] == static_extent) {
+                for (Element k = 0; k < static_extent; ++k) {
+                    for_each_serial<RetType>(begin, end, f, is..., begin[I] + k);
+                }
+                return;
+            }
+        }
         for (Element ii = begin[I]; ii < end[I]; ++ii) {
             for_each_serial<RetType>(begin, end, f, is..., ii);
         }
@@ -0,0 +1,335 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc/chunk_traits.hpp"
+#include "ddc/discrete_domain.hpp"
+
+namespace ddc {
+
+/// @brief An enum representing how the ghost points of a dimension are filled
+enum class HaloMode {
+    PERIODIC, ///< Ghost points take the value of the interior points one period away
+    REFLECTING, ///< Ghost points mirror the interior points about the boundary point
+    CONSTANT, ///< Ghost points take the value of the nearest boundary point
+};
+
+namespace detail {
+
+constexpr std::size_t nb_halo_regions(std::size_t const rank) noexcept
+{
+    std::size_t n = 1;
+    for (std::size_t r = 0; r < rank; ++r) {
+        n *= 3;
+    }
+    return n - 1;
+}
+
+/// A box of ghost points, in indices relative to the front of the ghosted domain
+template <std::size_t N>
+struct HaloRegion
+{
+    Kokkos::Array<std::size_t, N> begin;
+
+    Kokkos::Array<std::size_t, N> extents;
+};
+
+template <class Mdspan, std::size_t N>
+class HaloExchangeKokkosFunctor
+{
+    Mdspan m_data;
+
+    Kokkos::Array<HaloRegion<N>, nb_halo_regions(N)> m_regions;
+
+    /// Index of the first ghost point of each region in the linearised iteration space
+    Kokkos::Array<std::size_t, nb_halo_regions(N) + 1> m_offsets;
+
+    std::size_t m_nb_regions;
+
+    Kokkos::Array<std::ptrdiff_t, N> m_interior_begin;
+
+    Kokkos::Array<std::ptrdiff_t, N> m_interior_extents;
+
+    Kokkos::Array<HaloMode, N> m_modes;
+
+    KOKKOS_FUNCTION std::size_t source(std::size_t const r, std::size_t const ghost) const
+    {
+        std::ptrdiff_t const lo = m_interior_begin[r];
+        std::ptrdiff_t const n = m_interior_extents[r];
+        std::ptrdiff_t const hi = lo + n - 1;
+        std::ptrdiff_t const g = static_cast<std::ptrdiff_t>(ghost);
+        std::ptrdiff_t s = g;
+        if (g < lo || g > hi) {
+            if (m_modes[r] == HaloMode::PERIODIC) {
+                s = lo + ((g - lo) % n + n) % n;
+            } else if (m_modes[r] == HaloMode::REFLECTING) {
+                s = g < lo ? 2 * lo - g : 2 * hi - g;
+            } else {
+                s = g < lo ? lo : hi;
+            }
+        }
+        return static_cast<std::size_t>(s);
+    }
+
+    template <std::size_t... Rs>
+    KOKKOS_FUNCTION void copy(
+            Kokkos::Array<std::size_t, N> const& ghost,
+            std::index_sequence<Rs...>) const
+    {
+        m_data(ghost[Rs]...) = m_data(source(Rs, ghost[Rs])...);
+    }
+
+public:
+    HaloExchangeKokkosFunctor(
+            Mdspan const& data,
+            Kokkos::Array<HaloRegion<N>, nb_halo_regions(N)> const& regions,
+            Kokkos::Array<std::size_t, nb_halo_regions(N) + 1> const& offsets,
+            std::size_t const nb_regions,
+            Kokkos::Array<std::ptrdiff_t, N> const& interior_begin,
+            Kokkos::Array<std::ptrdiff_t, N> const& interior_extents,
+            Kokkos::Array<HaloMode, N> const& modes)
+        : m_data(data)
+        , m_regions(regions)
+        , m_offsets(offsets)
+        , m_nb_regions(nb_regions)
+        , m_interior_begin(interior_begin)
+        , m_interior_extents(interior_extents)
+        , m_modes(modes)
+    {
+    }
+
+    KOKKOS_FUNCTION void operator()(std::size_t const i) const
+    {
+        std::size_t region = 0;
+        while (region + 1 < m_nb_regions && i >= m_offsets[region + 1]) {
+            ++region;
+        }
+        HaloRegion<N> const& box = m_regions[region];
+        Kokkos::Array<std::size_t, N> ghost;
+        std::size_t linear = i - m_offsets[region];
+        for (std::size_t r = N; r > 0; --r) {
+            ghost[r - 1] = box.begin[r - 1] + linear % box.extents[r - 1];
+            linear /= box.extents[r - 1];
+        }
+        copy(ghost, std::make_index_sequence<N>());
+    }
+};
+
+} // namespace detail
+
+template <class DDom>
+class HaloExchange;
+
+/** Fills the ghost points of a chunk defined on a ghosted domain, such as the ones returned by
+ * `init_ghosted`.
+ *
+ * The ghost points are split into the 3^N-1 boxes surrounding the interior domain (faces, edges
+ * and corners). The boxes are computed once at construction and all of them are filled by a single
+ * kernel, each ghost point reading the interior point given by the `HaloMode` of every dimension.
+ */
+template <class... DDims>
+class HaloExchange<DiscreteDomain<DDims...>>
+{
+    static constexpr std::size_t s_rank = sizeof...(DDims);
+
+    static constexpr std::size_t s_max_nb_regions = detail::nb_halo_regions(s_rank);
+
+    using region_type = detail::HaloRegion<s_rank>;
+
+public:
+    using discrete_domain_type = DiscreteDomain<DDims...>;
+
+private:
+    discrete_domain_type m_domain;
+
+    discrete_domain_type m_ghosted_domain;
+
+    Kokkos::Array<HaloMode, s_rank> m_modes;
+
+    Kokkos::Array<region_type, s_max_nb_regions> m_regions {};
+
+    Kokkos::Array<std::size_t, s_max_nb_regions + 1> m_offsets {};
+
+    std::size_t m_nb_regions = 0;
+
+    Kokkos::Array<std::ptrdiff_t, s_rank> m_interior_begin;
+
+    Kokkos::Array<std::ptrdiff_t, s_rank> m_interior_extents;
+
+    static std::array<HaloMode, s_rank> uniform_modes(HaloMode const mode) noexcept
+    {
+        std::array<HaloMode, s_rank> modes;
+        modes.fill(mode);
+        return modes;
+    }
+
+public:
+    /** Precomputes the ghost regions of `ghosted_domain` around `domain`
+     * @param domain the interior domain
+     * @param ghosted_domain the domain including the ghost points
+     * @param modes how the ghost points of each dimension are filled
+     */
+    HaloExchange(
+            discrete_domain_type const& domain,
+            discrete_domain_type const& ghosted_domain,
+            std::array<HaloMode, s_rank> const& modes)
+        : m_domain(domain)
+        , m_ghosted_domain(ghosted_domain)
+    {
+        static_assert(s_rank > 0, "Expected at least one dimension");
+        std::array<std::size_t, s_rank> const interior_begin {static_cast<std::size_t>(
+                (front<DDims>(domain) - front<DDims>(ghosted_domain)).value())...};
+        std::array<std::size_t, s_rank> const interior_extents {
+                static_cast<std::size_t>(domain.template extent<DDims>().value())...};
+        std::array<std::size_t, s_rank> const ghosted_extents {
+                static_cast<std::size_t>(ghosted_domain.template extent<DDims>().value())...};
+        for (std::size_t r = 0; r < s_rank; ++r) {
+            m_modes[r] = modes[r];
+            m_interior_begin[r] = interior_begin[r];
+            m_interior_extents[r] = interior_extents[r];
+            assert(interior_begin[r] + interior_extents[r] <= ghosted_extents[r]);
+            assert(interior_extents[r] > 0);
+            assert(modes[r] != HaloMode::REFLECTING
+                   || (interior_begin[r] < interior_extents[r]
+                       && ghosted_extents[r] - interior_begin[r] < 2 * interior_extents[r]));
+        }
+
+        // Each region is identified by its position (pre-ghost, interior or post-ghost) in every
+        // dimension, the fully interior combination being skipped
+        m_offsets[0] = 0;
+        for (std::size_t id = 0; id <= s_max_nb_regions; ++id) {
+            region_type region {};
+            bool is_interior = true;
+            std::size_t size = 1;
+            std::size_t code = id;
+            for (std::size_t r = s_rank; r > 0; --r) {
+                std::size_t const position = code % 3;
+                code /= 3;
+                std::size_t const d = r - 1;
+                if (position == 0) {
+                    region.begin[d] = 0;
+                    region.extents[d] = interior_begin[d];
+                } else if (position == 1) {
+                    region.begin[d] = interior_begin[d];
+                    region.extents[d] = interior_extents[d];
+                } else {
+                    region.begin[d] = interior_begin[d] + interior_extents[d];
+                    region.extents[d] = ghosted_extents[d] - region.begin[d];
+                }
+                is_interior = is_interior && position == 1;
+                size *= region.extents[d];
+            }
+            if (!is_interior && size > 0) {
+                m_regions[m_nb_regions] = region;
+                m_offsets[m_nb_regions + 1] = m_offsets[m_nb_regions] + size;
+                ++m_nb_regions;
+            }
+        }
+    }
+
+    /** Precomputes the ghost regions of `ghosted_domain` around `domain`
+     * @param domain the interior domain
+     * @param ghosted_domain the domain including the ghost points
+     * @param mode how the ghost points of all dimensions are filled
+     */
+    HaloExchange(
+            discrete_domain_type const& domain,
+            discrete_domain_type const& ghosted_domain,
+            HaloMode const mode = HaloMode::PERIODIC)
+        : HaloExchange(domain, ghosted_domain, uniform_modes(mode))
+    {
+    }
+
+    discrete_domain_type domain() const noexcept
+    {
+        return m_domain;
+    }
+
+    discrete_domain_type ghosted_domain() const noexcept
+    {
+        return m_ghosted_domain;
+    }
+
+    /// Number of non-empty ghost regions
+    std::size_t nb_regions() const noexcept
+    {
+        return m_nb_regions;
+    }
+
+    /// Total number of ghost points
+    std::size_t nb_ghost_points() const noexcept
+    {
+        return m_offsets[m_nb_regions];
+    }
+
+    /** Fills the ghost points of `chunk` from its interior points
+     * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+     * @param[inout] chunk a borrowed chunk defined on the ghosted domain
+     */
+    template <class ExecSpace, class ChunkType>
+    void operator()(ExecSpace const& execution_space, ChunkType&& chunk) const
+    {
+        static_assert(is_borrowed_chunk_v<ChunkType>);
+        static_assert(
+                std::is_same_v<
+                        typename std::remove_reference_t<ChunkType>::mdomain_type,
+                        discrete_domain_type>,
+                "The chunk must be defined on the ghosted domain");
+        assert(chunk.domain() == m_ghosted_domain);
+        if (m_nb_regions == 0) {
+            return;
+        }
+        auto const data = chunk.allocation_mdspan();
+        detail::HaloExchangeKokkosFunctor<std::remove_const_t<decltype(data)>, s_rank> const
+                functor(data,
+                        m_regions,
+                        m_offsets,
+                        m_nb_regions,
+                        m_interior_begin,
+                        m_interior_extents,
+                        m_modes);
+        Kokkos::parallel_for(
+                "ddc_halo_exchange",
+                Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<std::size_t>>(
+                        execution_space,
+                        0,
+                        nb_ghost_points()),
+                functor);
+    }
+
+    /** Fills the ghost points of `chunk` from its interior points using the `Kokkos` default
+     * execution space
+     * @param[inout] chunk a borrowed chunk defined on the ghosted domain
+     */
+    template <class ChunkType>
+    void operator()(ChunkType&& chunk) const
+    {
+        (*this)(Kokkos::DefaultExecutionSpace(), std::forward<ChunkType>(chunk));
+    }
+};
+
+template <class... DDims>
+HaloExchange(DiscreteDomain<DDims...> const&, DiscreteDomain<DDims...> const&)
+        -> HaloExchange<DiscreteDomain<DDims...>>;
+
+template <class... DDims>
+HaloExchange(DiscreteDomain<DDims...> const&, DiscreteDomain<DDims...> const&, HaloMode)
+        -> HaloExchange<DiscreteDomain<DDims...>>;
+
+template <class... DDims>
+HaloExchange(
+        DiscreteDomain<DDims...> const&,
+        DiscreteDomain<DDims...> const&,
+        std::array<HaloMode, sizeof...(DDims)> const&) -> HaloExchange<DiscreteDomain<DDims...>>;
+
+} // namespace ddc
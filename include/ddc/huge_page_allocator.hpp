@@ -0,0 +1,345 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace ddc {
+
+/// @brief An enum representing the kind of pages backing a `HugePageAllocator` allocation
+enum class HugePageStatus {
+    HUGETLB, ///< Huge pages reserved in the hugetlbfs pool of the system
+    TRANSPARENT, ///< Regular pages at least partly promoted to transparent huge pages
+    ADVISED, ///< Regular pages the kernel was asked to promote, none promoted so far
+    NONE, ///< Regular pages only
+};
+
+namespace detail {
+
+/// Size of a huge page when the system does not report it, the usual x86-64 configuration
+inline constexpr std::size_t default_huge_page_size = std::size_t(2) << 20;
+
+/// The default size of the hugetlbfs pages of the system, `Hugepagesize` in `/proc/meminfo`
+inline std::size_t huge_page_size()
+{
+    static std::size_t const size = [] {
+        std::ifstream file("/proc/meminfo");
+        std::string line;
+        while (std::getline(file, line)) {
+            std::istringstream fields(line);
+            std::string key;
+            std::size_t kib = 0;
+            if ((fields >> key >> kib) && key == "Hugepagesize:" && kib > 0) {
+                return kib << 10;
+            }
+        }
+        return default_huge_page_size;
+    }();
+    return size;
+}
+
+/// The size of a transparent huge page, `/sys/kernel/mm/transparent_hugepage/hpage_pmd_size`
+inline std::size_t transparent_huge_page_size()
+{
+    static std::size_t const size = [] {
+        std::ifstream file("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+        std::size_t bytes = 0;
+        if ((file >> bytes) && bytes > 0) {
+            return bytes;
+        }
+        return default_huge_page_size;
+    }();
+    return size;
+}
+
+inline std::size_t round_up_to_page(std::size_t const n, std::size_t const page)
+{
+    return ((n + page - 1) / page) * page;
+}
+
+/** Number of bytes of `[begin, begin + size)` backed by transparent huge pages, the sum of the
+ * `AnonHugePages` of the mappings overlapping the range in `/proc/self/smaps`
+ */
+inline std::size_t transparent_huge_page_bytes(void const* const begin, std::size_t const size)
+{
+    std::uintptr_t const range_begin = reinterpret_cast<std::uintptr_t>(begin);
+    std::uintptr_t const range_end = range_begin + size;
+    std::ifstream file("/proc/self/smaps");
+    std::string line;
+    bool overlaps = false;
+    std::size_t bytes = 0;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string key;
+        fields >> key;
+        std::size_t const dash = key.find('-');
+        if (dash != std::string::npos && key.back() != ':') {
+            // Header of a mapping, e.g. "7f0000000000-7f0000400000 rw-p 00000000 00:00 0"
+            std::uintptr_t const map_begin = std::stoull(key.substr(0, dash), nullptr, 16);
+            std::uintptr_t const map_end = std::stoull(key.substr(dash + 1), nullptr, 16);
+            overlaps = map_begin < range_end && range_begin < map_end;
+        } else if (overlaps && key == "AnonHugePages:") {
+            std::size_t kib = 0;
+            fields >> kib;
+            bytes += kib << 10;
+        }
+    }
+    return bytes;
+}
+
+/// True if transparent huge pages are not disabled system-wide
+inline bool transparent_huge_pages_enabled()
+{
+    std::ifstream file("/sys/kernel/mm/transparent_hugepage/enabled");
+    std::string mode;
+    std::getline(file, mode);
+    // The active mode is written between brackets, e.g. "always [madvise] never"
+    return file && mode.find("[never]") == std::string::npos;
+}
+
+struct HugePageMapping
+{
+    void const* begin;
+
+    std::size_t size;
+
+    HugePageStatus status;
+};
+
+/// Mappings currently allocated by `HugePageAllocator`, indexed by address
+class HugePageRegistry
+{
+    std::mutex m_mutex;
+
+    std::map<void const*, HugePageMapping> m_mappings;
+
+public:
+    void insert(void const* const p, HugePageMapping const& mapping)
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_mappings.emplace(p, mapping);
+    }
+
+    HugePageMapping extract(void const* const p)
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        auto const it = m_mappings.find(p);
+        if (it == m_mappings.end()) {
+            return HugePageMapping {nullptr, 0, HugePageStatus::NONE};
+        }
+        HugePageMapping const mapping = it->second;
+        m_mappings.erase(it);
+        return mapping;
+    }
+
+    /// The mapping containing `p`, a `NONE` mapping of size zero if there is none
+    HugePageMapping find(void const* const p)
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        auto it = m_mappings.upper_bound(p);
+        if (it != m_mappings.begin()) {
+            --it;
+            std::uintptr_t const begin = reinterpret_cast<std::uintptr_t>(it->first);
+            if (reinterpret_cast<std::uintptr_t>(p) < begin + it->second.size) {
+                return it->second;
+            }
+        }
+        return HugePageMapping {nullptr, 0, HugePageStatus::NONE};
+    }
+};
+
+inline HugePageRegistry& huge_page_registry()
+{
+    static HugePageRegistry registry;
+    return registry;
+}
+
+/** Maps `n` bytes, from hugetlbfs if the system reserved enough huge pages, otherwise from regular
+ * pages aligned on a huge page and advised to be promoted to transparent huge pages.
+ */
+inline void* huge_page_allocate(std::size_t const n)
+{
+    if (n == 0) {
+        return nullptr;
+    }
+#if defined(__linux__)
+    HugePageStatus status = HugePageStatus::HUGETLB;
+    std::size_t size = round_up_to_page(n, huge_page_size());
+    void* p = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+    p = mmap(nullptr,
+             size,
+             PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+             -1,
+             0);
+#endif
+    if (p == MAP_FAILED) {
+        std::size_t const page = transparent_huge_page_size();
+        size = round_up_to_page(n, page);
+        // Over-allocate by one huge page to trim the mapping to a huge page boundary, transparent
+        // huge pages are only used for aligned ranges
+        std::size_t const padded_size = size + page;
+        void* const q = mmap(
+                nullptr,
+                padded_size,
+                PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS,
+                -1,
+                0);
+        if (q == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        std::uintptr_t const begin = reinterpret_cast<std::uintptr_t>(q);
+        std::uintptr_t const aligned_begin = round_up_to_page(begin, page);
+        std::size_t const head = aligned_begin - begin;
+        if (head > 0) {
+            munmap(q, head);
+        }
+        munmap(reinterpret_cast<void*>(aligned_begin + size), page - head);
+        p = reinterpret_cast<void*>(aligned_begin);
+        status = HugePageStatus::NONE;
+#if defined(MADV_HUGEPAGE)
+        if (madvise(p, size, MADV_HUGEPAGE) == 0 && transparent_huge_pages_enabled()) {
+            status = HugePageStatus::ADVISED;
+        }
+#endif
+    }
+#else
+    std::size_t const size = round_up_to_page(n, huge_page_size());
+    void* const p = Kokkos::kokkos_malloc<Kokkos::HostSpace>("ddc_huge_page_allocator", size);
+    HugePageStatus const status = HugePageStatus::NONE;
+#endif
+    huge_page_registry().insert(p, HugePageMapping {p, size, status});
+    return p;
+}
+
+inline void huge_page_deallocate(void* const p)
+{
+    if (p == nullptr) {
+        return;
+    }
+    [[maybe_unused]] HugePageMapping const mapping = huge_page_registry().extract(p);
+    assert(mapping.size > 0 && "pointer not allocated by HugePageAllocator");
+    if (mapping.size == 0) {
+        return;
+    }
+#if defined(__linux__)
+    munmap(p, mapping.size);
+#else
+    Kokkos::kokkos_free<Kokkos::HostSpace>(p);
+#endif
+}
+
+} // namespace detail
+
+/** The kind of pages backing the `HugePageAllocator` allocation containing `p`
+ * @param p a pointer inside an allocation of `HugePageAllocator`
+ * @return `NONE` if `p` was not allocated by a `HugePageAllocator`
+ *
+ * Transparent huge pages are only advised to the kernel, which promotes the pages when first
+ * touched or later by `khugepaged`, depending on the availability of contiguous physical memory.
+ * For such allocations, `/proc/self/smaps` is read to return `TRANSPARENT` only if some huge pages
+ * were actually granted, `ADVISED` otherwise, e.g. before the first touch.
+ */
+inline HugePageStatus huge_page_status(void const* const p)
+{
+    detail::HugePageMapping const mapping = detail::huge_page_registry().find(p);
+    if (mapping.status == HugePageStatus::ADVISED
+        && detail::transparent_huge_page_bytes(mapping.begin, mapping.size) > 0) {
+        return HugePageStatus::TRANSPARENT;
+    }
+    return mapping.status;
+}
+
+/** A host allocator backing large allocations with huge pages to reduce TLB misses.
+ *
+ * Allocations are rounded up to a multiple of the huge page size and mapped directly from the
+ * system. The hugetlbfs pool is used if the system reserved enough huge pages, otherwise the
+ * mapping is aligned on a huge page and advised to use transparent huge pages. The pages
+ * actually obtained are given by `huge_page_status`.
+ */
+template <class T>
+class HugePageAllocator
+{
+public:
+    using value_type = T;
+
+    using memory_space = Kokkos::HostSpace;
+
+    template <class U>
+    struct rebind
+    {
+        using other = HugePageAllocator<U>;
+    };
+
+    constexpr HugePageAllocator() = default;
+
+    constexpr HugePageAllocator(HugePageAllocator const& x) = default;
+
+    constexpr HugePageAllocator(HugePageAllocator&& x) noexcept = default;
+
+    template <class U>
+    constexpr explicit HugePageAllocator(HugePageAllocator<U> const&) noexcept
+    {
+    }
+
+    ~HugePageAllocator() = default;
+
+    constexpr HugePageAllocator& operator=(HugePageAllocator const& x) = default;
+
+    constexpr HugePageAllocator& operator=(HugePageAllocator&& x) noexcept = default;
+
+    template <class U>
+    constexpr HugePageAllocator& operator=(HugePageAllocator<U> const&) noexcept
+    {
+        return *this;
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n) const
+    {
+        return static_cast<T*>(detail::huge_page_allocate(sizeof(T) * n));
+    }
+
+    [[nodiscard]] T* allocate([[maybe_unused]] std::string const& label, std::size_t n) const
+    {
+        return allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t) const
+    {
+        detail::huge_page_deallocate(p);
+    }
+};
+
+template <class T, class U>
+constexpr bool operator==(HugePageAllocator<T> const&, HugePageAllocator<U> const&) noexcept
+{
+    return true;
+}
+
+template <class T, class U>
+constexpr bool operator!=(HugePageAllocator<T> const&, HugePageAllocator<U> const&) noexcept
+{
+    return false;
+}
+
+} // namespace ddc
@@ -669,24 +669,7 @@ KOKKOS_INLINE_FUNCTION ddc::DiscreteElement<NonUniformBsplinesKnots<DDim>> NonUn
     assert(x - rmin() >= -length() * 1e-14);
     assert(rmax() - x >= -length() * 1e-14);
 
-    if (x == rmin())
-        return m_break_point_domain.front();
-    if (x == rmax())
-        return m_break_point_domain.back() - 1;
-
-    // Binary search
-    ddc::DiscreteElement<knot_discrete_dimension_type> low = m_break_point_domain.front();
-    ddc::DiscreteElement<knot_discrete_dimension_type> high = m_break_point_domain.back();
-    ddc::DiscreteElement<knot_discrete_dimension_type> icell = low + (high - low) / 2;
-    while (x < ddc::coordinate(icell) || x >= ddc::coordinate(icell + 1)) {
-        if (x < ddc::coordinate(icell)) {
-            high = icell;
-        } else {
-            low = icell;
-        }
-        icell = low + (high - low) / 2;
-    }
-    return icell;
+    return ddc::find_cell(m_break_point_domain, x);
 }
 
 template <class CDim, std::size_t D>
@@ -10,6 +10,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "ddc/allocation_registry.hpp"
+
 namespace ddc {
 
 template <class T, class MemorySpace>
@@ -50,16 +52,23 @@ public:
 
     [[nodiscard]] T* allocate(std::size_t n) const
     {
-        return static_cast<T*>(Kokkos::kokkos_malloc<MemorySpace>(sizeof(T) * n));
+        return allocate("no-label", n);
     }
 
     [[nodiscard]] T* allocate(std::string const& label, std::size_t n) const
     {
-        return static_cast<T*>(Kokkos::kokkos_malloc<MemorySpace>(label, sizeof(T) * n));
+        T* const p = static_cast<T*>(Kokkos::kokkos_malloc<MemorySpace>(label, sizeof(T) * n));
+        AllocationRegistry& registry = allocation_registry();
+        if (registry.is_enabled()) {
+            registry.register_allocation(MemorySpace::name(), label, p, sizeof(T) * n);
+        }
+        return p;
     }
 
     void deallocate(T* p, std::size_t) const
     {
+        // Even if disabled, the registry forgets the allocations it tracked
+        allocation_registry().register_deallocation(p);
         Kokkos::kokkos_free(p);
     }
 };
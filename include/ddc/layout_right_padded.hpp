@@ -0,0 +1,230 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <experimental/mdspan>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc/detail/macros.hpp"
+
+namespace ddc {
+
+/** A row-major layout whose rows are padded to a multiple of `PaddingValue` elements.
+ *
+ * The innermost dimension is contiguous, the stride of the second innermost dimension is the
+ * extent of the innermost one rounded up to a multiple of `PaddingValue`. With an allocation
+ * aligned on `PaddingValue * sizeof(ElementType)` bytes, every row then starts on an aligned
+ * address. The required span size includes the padding of the last row.
+ */
+template <std::size_t PaddingValue>
+struct layout_right_padded
+{
+    static_assert(PaddingValue > 0, "The padding value must be positive");
+
+    static constexpr std::size_t padding_value = PaddingValue;
+
+    template <class Extents>
+    class mapping
+    {
+    public:
+        using extents_type = Extents;
+
+        using index_type = typename extents_type::index_type;
+
+        using size_type = typename extents_type::size_type;
+
+        using rank_type = typename extents_type::rank_type;
+
+        using layout_type = layout_right_padded;
+
+    private:
+        static constexpr std::size_t s_rank = extents_type::rank();
+
+        extents_type m_extents;
+
+        std::array<index_type, s_rank> m_strides {};
+
+        template <std::size_t... Rs, class... Indices>
+        KOKKOS_FUNCTION constexpr index_type offset(
+                std::index_sequence<Rs...>,
+                Indices const... idx) const noexcept
+        {
+            return ((static_cast<index_type>(idx) * m_strides[Rs]) + ... + index_type(0));
+        }
+
+    public:
+        KOKKOS_FUNCTION constexpr mapping() noexcept : mapping(extents_type()) {}
+
+        KOKKOS_FUNCTION constexpr mapping(extents_type const& extents) noexcept
+            : m_extents(extents)
+        {
+            if constexpr (s_rank > 0) {
+                m_strides[s_rank - 1] = 1;
+            }
+            if constexpr (s_rank > 1) {
+                index_type const n = m_extents.extent(s_rank - 1);
+                m_strides[s_rank - 2] = ((n + PaddingValue - 1) / PaddingValue) * PaddingValue;
+                for (std::size_t r = s_rank - 2; r > 0; --r) {
+                    m_strides[r - 1] = m_strides[r] * m_extents.extent(r);
+                }
+            }
+        }
+
+        KOKKOS_DEFAULTED_FUNCTION constexpr mapping(mapping const& other) = default;
+
+        KOKKOS_DEFAULTED_FUNCTION constexpr mapping(mapping&& other) = default;
+
+        KOKKOS_DEFAULTED_FUNCTION ~mapping() = default;
+
+        KOKKOS_DEFAULTED_FUNCTION constexpr mapping& operator=(mapping const& other) = default;
+
+        KOKKOS_DEFAULTED_FUNCTION constexpr mapping& operator=(mapping&& other) = default;
+
+        KOKKOS_FUNCTION constexpr extents_type const& extents() const noexcept
+        {
+            return m_extents;
+        }
+
+        /// Number of elements spanned by the mapping, including the padding of the last row
+        KOKKOS_FUNCTION constexpr index_type required_span_size() const noexcept
+        {
+            if constexpr (s_rank == 0) {
+                return 1;
+            } else {
+                return m_extents.extent(0) * m_strides[0];
+            }
+        }
+
+        template <class... Indices>
+        KOKKOS_FUNCTION constexpr index_type operator()(Indices const... idx) const noexcept
+        {
+            static_assert(sizeof...(Indices) == s_rank, "Invalid number of indices");
+            return offset(std::make_index_sequence<s_rank>(), idx...);
+        }
+
+        static KOKKOS_FUNCTION constexpr bool is_always_unique() noexcept
+        {
+            return true;
+        }
+
+        static KOKKOS_FUNCTION constexpr bool is_always_exhaustive() noexcept
+        {
+            return PaddingValue == 1 || s_rank < 2;
+        }
+
+        static KOKKOS_FUNCTION constexpr bool is_always_strided() noexcept
+        {
+            return true;
+        }
+
+        static KOKKOS_FUNCTION constexpr bool is_unique() noexcept
+        {
+            return true;
+        }
+
+        KOKKOS_FUNCTION constexpr bool is_exhaustive() const noexcept
+        {
+            if constexpr (s_rank < 2) {
+                return true;
+            } else {
+                return m_strides[s_rank - 2] == m_extents.extent(s_rank - 1);
+            }
+        }
+
+        static KOKKOS_FUNCTION constexpr bool is_strided() noexcept
+        {
+            return true;
+        }
+
+        KOKKOS_FUNCTION constexpr index_type stride(rank_type const r) const noexcept
+        {
+            return m_strides[r];
+        }
+
+        KOKKOS_FUNCTION friend constexpr bool operator==(
+                mapping const& lhs,
+                mapping const& rhs) noexcept
+        {
+            return lhs.m_extents == rhs.m_extents;
+        }
+
+        KOKKOS_FUNCTION friend constexpr bool operator!=(
+                mapping const& lhs,
+                mapping const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+};
+
+template <class Layout>
+struct is_layout_right_padded : std::false_type
+{
+};
+
+template <std::size_t PaddingValue>
+struct is_layout_right_padded<layout_right_padded<PaddingValue>> : std::true_type
+{
+};
+
+template <class Layout>
+inline constexpr bool is_layout_right_padded_v = is_layout_right_padded<Layout>::value;
+
+/// Padded layout aligning each row of `ElementType` on `Alignment` bytes
+template <class ElementType, std::size_t Alignment = 64>
+using aligned_layout_right = layout_right_padded<
+        (Alignment % sizeof(ElementType) == 0 && Alignment >= sizeof(ElementType))
+                ? Alignment / sizeof(ElementType)
+                : 1>;
+
+namespace detail {
+
+template <class Layout>
+inline constexpr bool is_submdspan_layout_v
+        = std::is_same_v<Layout, std::experimental::layout_left>
+          || std::is_same_v<Layout, std::experimental::layout_right>
+          || std::is_same_v<Layout, std::experimental::layout_stride>;
+
+/// True if a mapping of `Layout` can be built from the extents alone, i.e. memory with this
+/// layout can be allocated knowing only the domain
+template <class Layout, class Extents>
+inline constexpr bool is_allocatable_layout_v
+        = std::is_constructible_v<typename Layout::template mapping<Extents>, Extents>;
+
+/// `submdspan` only handles the standard layouts, other strided layouts are viewed as
+/// `layout_stride`
+template <class ElementType, class Extents, class Layout, class Accessor>
+KOKKOS_FUNCTION constexpr auto as_submdspan_compatible(
+        std::experimental::mdspan<ElementType, Extents, Layout, Accessor> const& s)
+{
+    DDC_IF_NVCC_THEN_PUSH_AND_SUPPRESS(implicit_return_from_non_void_function)
+    if constexpr (is_submdspan_layout_v<Layout>) {
+        return s;
+    } else {
+        std::array<std::size_t, Extents::rank()> strides {};
+        for (std::size_t r = 0; r < Extents::rank(); ++r) {
+            strides[r] = s.stride(r);
+        }
+        return std::experimental::mdspan<
+                ElementType,
+                Extents,
+                std::experimental::layout_stride,
+                Accessor>(
+                s.data_handle(),
+                std::experimental::layout_stride::mapping<Extents>(s.extents(), strides),
+                s.accessor());
+    }
+    DDC_IF_NVCC_THEN_POP
+}
+
+} // namespace detail
+
+} // namespace ddc
@@ -0,0 +1,352 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cassert>
+#include <ostream>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc/coordinate.hpp"
+#include "ddc/discrete_domain.hpp"
+#include "ddc/discrete_element.hpp"
+#include "ddc/discrete_space.hpp"
+#include "ddc/discrete_vector.hpp"
+#include "ddc/real_type.hpp"
+
+namespace ddc {
+
+namespace detail {
+
+struct MappedSamplingBase
+{
+};
+
+} // namespace detail
+
+/** MappedSampling models a non-uniform discretization of the provided continuous dimension given
+ * by an analytic mapping of a uniform one.
+ *
+ * The point `i` is the image by `Map` of the reference coordinate \f$\xi_i = \xi_0 + i h\f$, no
+ * coordinate is stored. `Map` must be a trivially copyable and strictly increasing function
+ * providing, all as `KOKKOS_FUNCTION`s:
+ * - `Real operator()(Real xi) const` the position of the reference coordinate `xi`,
+ * - `Real inverse(Real x) const` the reference coordinate of the position `x`,
+ * - `Real derivative(Real xi) const` the derivative of the mapping at `xi`.
+ *
+ * For instance, \f$x(\xi) = \tanh(s (2 \xi - 1)) / \tanh(s)\f$ on \f$[0, 1]\f$ clusters the
+ * points at both ends of \f$[-1, 1]\f$.
+ */
+template <class CDim, class Map>
+class MappedSampling : detail::MappedSamplingBase
+{
+    static_assert(std::is_trivially_copyable_v<Map>, "The mapping must be trivially copyable");
+
+public:
+    using continuous_dimension_type = CDim;
+
+    using continuous_element_type = Coordinate<CDim>;
+
+    using map_type = Map;
+
+
+    using discrete_dimension_type = MappedSampling;
+
+public:
+    template <class DDim, class MemorySpace>
+    class Impl
+    {
+        template <class ODDim, class OMemorySpace>
+        friend class Impl;
+
+    private:
+        Map m_map {};
+
+        Real m_reference_origin {0};
+
+        Real m_reference_step {1};
+
+    public:
+        using discrete_dimension_type = MappedSampling;
+
+        using discrete_domain_type = DiscreteDomain<DDim>;
+
+        using discrete_element_type = DiscreteElement<DDim>;
+
+        using discrete_vector_type = DiscreteVector<DDim>;
+
+        Impl() = default;
+
+        Impl(Impl const&) = delete;
+
+        template <class OriginMemorySpace>
+        explicit Impl(Impl<DDim, OriginMemorySpace> const& impl)
+            : m_map(impl.m_map)
+            , m_reference_origin(impl.m_reference_origin)
+            , m_reference_step(impl.m_reference_step)
+        {
+        }
+
+        Impl(Impl&&) = default;
+
+        /** @brief Construct a `Impl` from a mapping and a uniform sampling of its reference
+         * coordinate.
+         *
+         * @param map the mapping from the reference coordinate to `CDim`
+         * @param reference_origin the reference coordinate of mesh coordinate 0
+         * @param reference_step the reference distance between two points of mesh distance 1
+         */
+        Impl(Map const& map, Real reference_origin, Real reference_step)
+            : m_map(map)
+            , m_reference_origin(reference_origin)
+            , m_reference_step(reference_step)
+        {
+            assert(reference_step > 0);
+        }
+
+        ~Impl() = default;
+
+        /// @brief The mapping from the reference coordinate to `CDim`
+        KOKKOS_FUNCTION Map const& map() const noexcept
+        {
+            return m_map;
+        }
+
+        /// @brief Reference coordinate of mesh coordinate 0
+        KOKKOS_FUNCTION Real reference_origin() const noexcept
+        {
+            return m_reference_origin;
+        }
+
+        /// @brief Reference distance between two points of mesh distance 1
+        KOKKOS_FUNCTION Real reference_step() const noexcept
+        {
+            return m_reference_step;
+        }
+
+        /// @brief Lower bound index of the mesh
+        KOKKOS_FUNCTION discrete_element_type front() const noexcept
+        {
+            return discrete_element_type {0};
+        }
+
+        /// @brief Convert a mesh index into its reference coordinate
+        KOKKOS_FUNCTION Real
+        reference_coordinate(discrete_element_type const& icoord) const noexcept
+        {
+            return m_reference_origin + static_cast<Real>(icoord.uid()) * m_reference_step;
+        }
+
+        /// @brief Convert a mesh index into a position in `CDim`
+        KOKKOS_FUNCTION continuous_element_type
+        coordinate(discrete_element_type const& icoord) const noexcept
+        {
+            return continuous_element_type(m_map(reference_coordinate(icoord)));
+        }
+
+        /** @brief Derivative of the position with respect to the mesh index at `icoord`
+         *
+         * It approximates the distances between neighbouring points, e.g. as the metric term of
+         * a finite difference scheme written in the reference coordinate.
+         */
+        KOKKOS_FUNCTION Real jacobian(discrete_element_type const& icoord) const noexcept
+        {
+            return m_map.derivative(reference_coordinate(icoord)) * m_reference_step;
+        }
+
+        /** @brief Convert a position in `CDim` into the index of the cell containing it
+         *
+         * The cell `i` is \f$[x_i, x_{i+1}[\f$, found by the inverse of the mapping. The
+         * position must not be before the first point.
+         */
+        KOKKOS_FUNCTION discrete_element_type
+        find_cell(continuous_element_type const& x) const noexcept
+        {
+            assert(x >= coordinate(front()));
+            Real const t = (m_map.inverse(x) - m_reference_origin) / m_reference_step;
+            discrete_element_type icell(static_cast<DiscreteElementType>(t > 0 ? t : 0));
+            // Stay consistent with `coordinate` despite the rounding errors
+            if (icell.uid() > 0 && coordinate(icell) > x) {
+                --icell;
+            } else if (coordinate(icell + 1) <= x) {
+                ++icell;
+            }
+            return icell;
+        }
+    };
+
+    /** Construct a Impl<Kokkos::HostSpace> and associated discrete_domain_type from the image by
+     *  `map` of the reference segment \f$[a, b]\f$ uniformly sampled with `n` points.
+     *
+     * @param map the mapping from the reference coordinate to `CDim`
+     * @param a reference coordinate of the first point of the domain
+     * @param b reference coordinate of the last point of the domain
+     * @param n number of points to map on the segment \f$[a, b]\f$ including a & b
+     */
+    template <class DDim>
+    static std::tuple<typename DDim::template Impl<DDim, Kokkos::HostSpace>, DiscreteDomain<DDim>>
+    init(Map const& map, Real a, Real b, DiscreteVector<DDim> n)
+    {
+        assert(a < b);
+        assert(n > 1);
+        typename DDim::template Impl<DDim, Kokkos::HostSpace> disc(map, a, (b - a) / (n - 1));
+        DiscreteDomain<DDim> domain {disc.front(), n};
+        return std::make_tuple(std::move(disc), std::move(domain));
+    }
+
+    /** Construct a mapped `DiscreteDomain` from the image by `map` of the reference segment
+     *  \f$[a, b]\f$ uniformly sampled with `n` points. The ghost points continue the uniform
+     *  sampling of the reference coordinate, the mapping must be defined there.
+     *
+     * @param map the mapping from the reference coordinate to `CDim`
+     * @param a reference coordinate of the first point of the domain
+     * @param b reference coordinate of the last point of the domain
+     * @param n the number of points to map the segment \f$[a, b]\f$ including a & b
+     * @param n_ghosts_before number of additional "ghost" points before the segment
+     * @param n_ghosts_after number of additional "ghost" points after the segment
+     */
+    template <class DDim>
+    static std::tuple<
+            typename DDim::template Impl<DDim, Kokkos::HostSpace>,
+            DiscreteDomain<DDim>,
+            DiscreteDomain<DDim>,
+            DiscreteDomain<DDim>,
+            DiscreteDomain<DDim>>
+    init_ghosted(
+            Map const& map,
+            Real a,
+            Real b,
+            DiscreteVector<DDim> n,
+            DiscreteVector<DDim> n_ghosts_before,
+            DiscreteVector<DDim> n_ghosts_after)
+    {
+        using discrete_domain_type = DiscreteDomain<DDim>;
+        assert(a < b);
+        assert(n > 1);
+        Real const reference_step = (b - a) / (n - 1);
+        typename DDim::template Impl<DDim, Kokkos::HostSpace>
+                disc(map, a - n_ghosts_before.value() * reference_step, reference_step);
+        discrete_domain_type ghosted_domain
+                = discrete_domain_type(disc.front(), n + n_ghosts_before + n_ghosts_after);
+        discrete_domain_type pre_ghost
+                = discrete_domain_type(ghosted_domain.front(), n_ghosts_before);
+        discrete_domain_type main_domain
+                = discrete_domain_type(ghosted_domain.front() + n_ghosts_before, n);
+        discrete_domain_type post_ghost
+                = discrete_domain_type(main_domain.back() + 1, n_ghosts_after);
+        return std::make_tuple(
+                std::move(disc),
+                std::move(main_domain),
+                std::move(ghosted_domain),
+                std::move(pre_ghost),
+                std::move(post_ghost));
+    }
+
+    /** Construct a mapped `DiscreteDomain` from the image by `map` of the reference segment
+     *  \f$[a, b]\f$ uniformly sampled with `n` points.
+     *
+     * @param map the mapping from the reference coordinate to `CDim`
+     * @param a reference coordinate of the first point of the domain
+     * @param b reference coordinate of the last point of the domain
+     * @param n the number of points to map the segment \f$[a, b]\f$ including a & b
+     * @param n_ghosts number of additional "ghost" points before and after the segment
+     */
+    template <class DDim>
+    static std::tuple<
+            typename DDim::template Impl<DDim, Kokkos::HostSpace>,
+            DiscreteDomain<DDim>,
+            DiscreteDomain<DDim>,
+            DiscreteDomain<DDim>,
+            DiscreteDomain<DDim>>
+    init_ghosted(
+            Map const& map,
+            Real a,
+            Real b,
+            DiscreteVector<DDim> n,
+            DiscreteVector<DDim> n_ghosts)
+    {
+        return init_ghosted(map, a, b, n, n_ghosts, n_ghosts);
+    }
+};
+
+template <class DDim>
+struct is_mapped_sampling : public std::is_base_of<detail::MappedSamplingBase, DDim>
+{
+};
+
+template <class DDim>
+constexpr bool is_mapped_sampling_v = is_mapped_sampling<DDim>::value;
+
+template <
+        class DDimImpl,
+        std::enable_if_t<is_mapped_sampling_v<typename DDimImpl::discrete_dimension_type>, int>
+        = 0>
+std::ostream& operator<<(std::ostream& out, DDimImpl const& mesh)
+{
+    return out << "MappedSampling( reference_origin=" << mesh.reference_origin()
+               << ", reference_step=" << mesh.reference_step() << " )";
+}
+
+template <class DDim, std::enable_if_t<is_mapped_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> coordinate(
+        DiscreteElement<DDim> const& c)
+{
+    return discrete_space<DDim>().coordinate(c);
+}
+
+/// @brief Index of the cell containing `x`, the cell `i` being \f$[x_i, x_{i+1}[\f$
+template <class DDim, std::enable_if_t<is_mapped_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION DiscreteElement<DDim> find_cell(
+        Coordinate<typename DDim::continuous_dimension_type> const& x)
+{
+    return discrete_space<DDim>().find_cell(x);
+}
+
+/// @brief Derivative of the position with respect to the mesh index at `i`
+template <class DDim, std::enable_if_t<is_mapped_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION Real jacobian(DiscreteElement<DDim> const& i)
+{
+    return discrete_space<DDim>().jacobian(i);
+}
+
+template <class DDim, std::enable_if_t<is_mapped_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> distance_at_left(
+        DiscreteElement<DDim> i)
+{
+    return coordinate(i) - coordinate(i - 1);
+}
+
+template <class DDim, std::enable_if_t<is_mapped_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> distance_at_right(
+        DiscreteElement<DDim> i)
+{
+    return coordinate(i + 1) - coordinate(i);
+}
+
+template <class DDim, std::enable_if_t<is_mapped_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> rmin(
+        DiscreteDomain<DDim> const& d)
+{
+    return coordinate(d.front());
+}
+
+template <class DDim, std::enable_if_t<is_mapped_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> rmax(
+        DiscreteDomain<DDim> const& d)
+{
+    return coordinate(d.back());
+}
+
+template <class DDim, std::enable_if_t<is_mapped_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> rlength(
+        DiscreteDomain<DDim> const& d)
+{
+    return rmax(d) - rmin(d);
+}
+
+} // namespace ddc
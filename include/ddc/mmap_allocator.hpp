@@ -0,0 +1,366 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+
+namespace ddc {
+
+/// @brief An enum representing how a file is mapped by `MmapAllocator`
+enum class MmapMode {
+    READ, ///< Maps an existing file, modifications are private and never written back
+    READ_WRITE, ///< Maps an existing file, modifications are written back
+    CREATE, ///< Creates or truncates the file, modifications are written back
+};
+
+/** The header of the files mapped by `MmapAllocator`, followed by the payload.
+ *
+ * The header is 128 bytes long so that the payload is aligned on a cache line.
+ */
+struct MmapFileHeader
+{
+    static constexpr char s_magic[8] = {'D', 'D', 'C', 'M', 'M', 'A', 'P', '\0'};
+
+    static constexpr std::uint64_t s_version = 2;
+
+    /// Largest rank of a mapped chunk
+    static constexpr std::size_t s_max_rank = 11;
+
+    char magic[8];
+
+    std::uint64_t version;
+
+    /// Size of an element in bytes
+    std::uint64_t element_size;
+
+    /// Number of elements of the payload
+    std::uint64_t nb_elements;
+
+    std::uint64_t rank;
+
+    /// Extents of the payload, stored in the order of `layout_right`, the unused ones are zero
+    std::uint64_t extents[s_max_rank];
+};
+
+static_assert(sizeof(MmapFileHeader) == 128);
+
+namespace detail {
+
+/// @param error the `errno` of the failed call, saved before any other system call
+[[noreturn]] inline void throw_mmap_error(
+        std::string const& what,
+        std::string const& path,
+        int const error)
+{
+    throw std::runtime_error(
+            "MmapAllocator: " + what + " '" + path + "': " + std::strerror(error));
+}
+
+/// Closes `fd` and throws the error `errno` had before closing it
+[[noreturn]] inline void close_and_throw_mmap_error(
+        int const fd,
+        std::string const& what,
+        std::string const& path)
+{
+    int const error = errno;
+    ::close(fd);
+    throw_mmap_error(what, path, error);
+}
+
+/// The mapping of a file, shared by the copies of an `MmapAllocator`
+class MmapFile
+{
+    std::string m_path;
+
+    MmapMode m_mode;
+
+    void* m_base = nullptr;
+
+    std::size_t m_size = 0;
+
+public:
+    MmapFile(std::string path, MmapMode const mode) : m_path(std::move(path)), m_mode(mode) {}
+
+    MmapFile(MmapFile const& x) = delete;
+
+    MmapFile(MmapFile&& x) = delete;
+
+    ~MmapFile()
+    {
+        unmap();
+    }
+
+    MmapFile& operator=(MmapFile const& x) = delete;
+
+    MmapFile& operator=(MmapFile&& x) = delete;
+
+    std::string const& path() const noexcept
+    {
+        return m_path;
+    }
+
+    MmapMode mode() const noexcept
+    {
+        return m_mode;
+    }
+
+    bool is_mapped() const noexcept
+    {
+        return m_base != nullptr;
+    }
+
+    /** Maps the file and returns a pointer to its payload
+     * @param element_size the size of an element in bytes
+     * @param extents the extents of the payload, in the order of `layout_right`
+     */
+    template <std::size_t Rank>
+    void* map(std::size_t const element_size, std::array<std::size_t, Rank> const& extents)
+    {
+        static_assert(Rank <= MmapFileHeader::s_max_rank, "The rank is too large to be mapped");
+        if (is_mapped()) {
+            throw std::runtime_error("MmapAllocator: '" + m_path + "' is already mapped");
+        }
+        std::size_t nb_elements = 1;
+        for (std::size_t const extent : extents) {
+            nb_elements *= extent;
+        }
+        std::size_t const size = sizeof(MmapFileHeader) + element_size * nb_elements;
+        int const flags = m_mode == MmapMode::READ ? O_RDONLY
+                          : m_mode == MmapMode::READ_WRITE ? O_RDWR
+                                                           : O_RDWR | O_CREAT | O_TRUNC;
+        int const fd = ::open(m_path.c_str(), flags, 0644);
+        if (fd == -1) {
+            throw_mmap_error("cannot open", m_path, errno);
+        }
+        if (m_mode == MmapMode::CREATE) {
+            if (::ftruncate(fd, static_cast<off_t>(size)) == -1) {
+                close_and_throw_mmap_error(fd, "cannot resize", m_path);
+            }
+        } else {
+            struct stat st;
+            if (::fstat(fd, &st) == -1) {
+                close_and_throw_mmap_error(fd, "cannot stat", m_path);
+            }
+            if (static_cast<std::size_t>(st.st_size) != size) {
+                ::close(fd);
+                throw std::runtime_error(
+                        "MmapAllocator: '" + m_path + "' has " + std::to_string(st.st_size)
+                        + " bytes, " + std::to_string(size) + " expected");
+            }
+        }
+        // Read-only files are mapped privately so that the chunk can still be written to
+        int const protection = PROT_READ | PROT_WRITE;
+        int const sharing = m_mode == MmapMode::READ ? MAP_PRIVATE : MAP_SHARED;
+        void* const base = ::mmap(nullptr, size, protection, sharing, fd, 0);
+        if (base == MAP_FAILED) {
+            close_and_throw_mmap_error(fd, "cannot map", m_path);
+        }
+        ::close(fd);
+        MmapFileHeader* const header = static_cast<MmapFileHeader*>(base);
+        if (m_mode == MmapMode::CREATE) {
+            *header = MmapFileHeader {};
+            std::memcpy(header->magic, MmapFileHeader::s_magic, sizeof(header->magic));
+            header->version = MmapFileHeader::s_version;
+            header->element_size = element_size;
+            header->nb_elements = nb_elements;
+            header->rank = Rank;
+            for (std::size_t i = 0; i < Rank; ++i) {
+                header->extents[i] = extents[i];
+            }
+        } else {
+            bool valid = std::memcmp(header->magic, MmapFileHeader::s_magic, sizeof(header->magic))
+                                 == 0
+                         && header->version == MmapFileHeader::s_version
+                         && header->element_size == element_size
+                         && header->nb_elements == nb_elements && header->rank == Rank;
+            for (std::size_t i = 0; valid && i < Rank; ++i) {
+                // The same number of elements in another shape would be silently scrambled
+                valid = header->extents[i] == extents[i];
+            }
+            if (!valid) {
+                ::munmap(base, size);
+                throw std::runtime_error(
+                        "MmapAllocator: '" + m_path
+                        + "' has an invalid header or was written with other extents");
+            }
+        }
+        m_base = base;
+        m_size = size;
+        return static_cast<std::byte*>(base) + sizeof(MmapFileHeader);
+    }
+
+    /// Writes the modified pages back to the file and waits for the completion
+    void sync() const
+    {
+        if (is_mapped() && m_mode != MmapMode::READ && ::msync(m_base, m_size, MS_SYNC) == -1) {
+            throw_mmap_error("cannot synchronize", m_path, errno);
+        }
+    }
+
+    /// Writes the modified pages back to the file and unmaps it
+    void unmap() noexcept
+    {
+        if (is_mapped()) {
+            if (m_mode != MmapMode::READ) {
+                ::msync(m_base, m_size, MS_SYNC);
+            }
+            ::munmap(m_base, m_size);
+            m_base = nullptr;
+            m_size = 0;
+        }
+    }
+};
+
+} // namespace detail
+
+/** An allocator using a memory-mapped file as the storage of a single host `Chunk`.
+ *
+ * The file is made of a `MmapFileHeader` followed by the elements in the order of `layout_right`,
+ * the only layout of the chunks using this allocator. The header records the extents of the chunk,
+ * which are checked when the file is mapped again.
+ * Pages are read from the file when first accessed, so opening a large file is immediate and
+ * only the parts actually used are loaded in memory. In `READ_WRITE` and `CREATE` modes the
+ * modifications are written back by `sync` and when the chunk is destroyed.
+ *
+ * Copies of an `MmapAllocator` refer to the same file, which can only be mapped once at a time.
+ */
+template <class T>
+class MmapAllocator
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be mapped");
+
+    template <class>
+    friend class MmapAllocator;
+
+    std::shared_ptr<detail::MmapFile> m_file;
+
+public:
+    using value_type = T;
+
+    using memory_space = Kokkos::HostSpace;
+
+    template <class U>
+    struct rebind
+    {
+        using other = MmapAllocator<U>;
+    };
+
+    /** Refers to the file at `path`, which is mapped at the first allocation
+     * @param path the path of the file
+     * @param mode how the file is mapped
+     */
+    explicit MmapAllocator(std::string path, MmapMode const mode = MmapMode::READ_WRITE)
+        : m_file(std::make_shared<detail::MmapFile>(std::move(path), mode))
+    {
+    }
+
+    MmapAllocator(MmapAllocator const& x) = default;
+
+    MmapAllocator(MmapAllocator&& x) noexcept = default;
+
+    template <class U>
+    explicit MmapAllocator(MmapAllocator<U> const& x) noexcept : m_file(x.m_file)
+    {
+    }
+
+    ~MmapAllocator() = default;
+
+    MmapAllocator& operator=(MmapAllocator const& x) = default;
+
+    MmapAllocator& operator=(MmapAllocator&& x) noexcept = default;
+
+    template <class U>
+    MmapAllocator& operator=(MmapAllocator<U> const& x) noexcept
+    {
+        m_file = x.m_file;
+        return *this;
+    }
+
+    /// Maps the file as a one-dimensional payload of `n` elements
+    [[nodiscard]] T* allocate(std::size_t n) const
+    {
+        return static_cast<T*>(m_file->map(sizeof(T), std::array<std::size_t, 1> {n}));
+    }
+
+    [[nodiscard]] T* allocate([[maybe_unused]] std::string const& label, std::size_t n) const
+    {
+        return allocate(n);
+    }
+
+    /** Maps the file as the payload of a `layout_right` chunk, called by `Chunk`
+     * @param label the label of the chunk, unused
+     * @param extents the extents of the chunk
+     */
+    template <std::size_t Rank>
+    [[nodiscard]] T* allocate(
+            [[maybe_unused]] std::string const& label,
+            std::array<std::size_t, Rank> const& extents) const
+    {
+        return static_cast<T*>(m_file->map(sizeof(T), extents));
+    }
+
+    void deallocate(T*, std::size_t) const
+    {
+        m_file->unmap();
+    }
+
+    /// Writes the modifications of the mapped chunk back to the file
+    void sync() const
+    {
+        m_file->sync();
+    }
+
+    std::string const& path() const noexcept
+    {
+        return m_file->path();
+    }
+
+    MmapMode mode() const noexcept
+    {
+        return m_file->mode();
+    }
+
+    /// The file shared by the copies of this allocator
+    std::shared_ptr<detail::MmapFile> const& file() const noexcept
+    {
+        return m_file;
+    }
+};
+
+template <class T, class U>
+bool operator==(MmapAllocator<T> const& lhs, MmapAllocator<U> const& rhs) noexcept
+{
+    return lhs.file() == rhs.file();
+}
+
+template <class T, class U>
+bool operator!=(MmapAllocator<T> const& lhs, MmapAllocator<U> const& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+} // namespace ddc
+
+#endif
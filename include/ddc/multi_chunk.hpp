@@ -0,0 +1,362 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc/chunk.hpp"
+#include "ddc/detail/type_seq.hpp"
+#include "ddc/discrete_domain.hpp"
+#include "ddc/discrete_element.hpp"
+#include "ddc/discrete_vector.hpp"
+#include "ddc/kokkos_allocator.hpp"
+
+namespace ddc {
+
+/** The components of a `MultiChunk`, each identified by a tag.
+ *
+ * It is also the discrete dimension indexing the components in the storage of a `MultiChunk`.
+ */
+template <class... Tags>
+struct Components
+{
+    static_assert(sizeof...(Tags) > 0, "Expected at least one component");
+
+    static KOKKOS_FUNCTION constexpr std::size_t size() noexcept
+    {
+        return sizeof...(Tags);
+    }
+};
+
+/// The number of components is known at compile time
+template <class... Tags>
+inline constexpr std::size_t static_extent_v<Components<Tags...>> = sizeof...(Tags);
+
+/** A layout storing the components of a `MultiChunk` in blocks.
+ *
+ * The first extent is the component one. In memory, it is placed after the `NbOuterDims`
+ * outermost other extents, the data being row-major otherwise. Each block then holds the values of
+ * every component over the remaining innermost extents, one component after the other:
+ * - `NbOuterDims == 0` stores each component in its own contiguous array (SoA),
+ * - `NbOuterDims == rank - 1` stores the components of each point next to each other (AoS),
+ * - the values in between give array of structures of arrays (AoSoA) blocking.
+ */
+template <std::size_t NbOuterDims>
+struct layout_aosoa
+{
+    static constexpr std::size_t nb_outer_dims = NbOuterDims;
+
+    template <class Extents>
+    class mapping
+    {
+    public:
+        using extents_type = Extents;
+
+        using index_type = typename extents_type::index_type;
+
+        using size_type = typename extents_type::size_type;
+
+        using rank_type = typename extents_type::rank_type;
+
+        using layout_type = layout_aosoa;
+
+    private:
+        static constexpr std::size_t s_rank = extents_type::rank();
+
+        static_assert(NbOuterDims < s_rank, "Too many outer dimensions for the rank");
+
+        extents_type m_extents;
+
+        std::array<index_type, s_rank> m_strides {};
+
+        template <std::size_t... Rs, class... Indices>
+        KOKKOS_FUNCTION constexpr index_type offset(
+                std::index_sequence<Rs...>,
+                Indices const... idx) const noexcept
+        {
+            return ((static_cast<index_type>(idx) * m_strides[Rs]) + ... + index_type(0));
+        }
+
+        /// Extent stored at position `p` in memory, from the outermost one
+        static KOKKOS_FUNCTION constexpr std::size_t stored_extent(std::size_t const p) noexcept
+        {
+            return p < NbOuterDims ? p + 1 : p == NbOuterDims ? 0 : p;
+        }
+
+    public:
+        KOKKOS_FUNCTION constexpr mapping() noexcept : mapping(extents_type()) {}
+
+        KOKKOS_FUNCTION constexpr mapping(extents_type const& extents) noexcept
+            : m_extents(extents)
+        {
+            index_type stride = 1;
+            for (std::size_t p = s_rank; p > 0; --p) {
+                std::size_t const r = stored_extent(p - 1);
+                m_strides[r] = stride;
+                stride *= m_extents.extent(r);
+            }
+        }
+
+        KOKKOS_DEFAULTED_FUNCTION constexpr mapping(mapping const& other) = default;
+
+        KOKKOS_DEFAULTED_FUNCTION constexpr mapping(mapping&& other) = default;
+
+        KOKKOS_DEFAULTED_FUNCTION ~mapping() = default;
+
+        KOKKOS_DEFAULTED_FUNCTION constexpr mapping& operator=(mapping const& other) = default;
+
+        KOKKOS_DEFAULTED_FUNCTION constexpr mapping& operator=(mapping&& other) = default;
+
+        KOKKOS_FUNCTION constexpr extents_type const& extents() const noexcept
+        {
+            return m_extents;
+        }
+
+        KOKKOS_FUNCTION constexpr index_type required_span_size() const noexcept
+        {
+            index_type size = 1;
+            for (std::size_t r = 0; r < s_rank; ++r) {
+                size *= m_extents.extent(r);
+            }
+            return size;
+        }
+
+        template <class... Indices>
+        KOKKOS_FUNCTION constexpr index_type operator()(Indices const... idx) const noexcept
+        {
+            static_assert(sizeof...(Indices) == s_rank, "Invalid number of indices");
+            return offset(std::make_index_sequence<s_rank>(), idx...);
+        }
+
+        static KOKKOS_FUNCTION constexpr bool is_always_unique() noexcept
+        {
+            return true;
+        }
+
+        static KOKKOS_FUNCTION constexpr bool is_always_exhaustive() noexcept
+        {
+            return true;
+        }
+
+        static KOKKOS_FUNCTION constexpr bool is_always_strided() noexcept
+        {
+            return true;
+        }
+
+        static KOKKOS_FUNCTION constexpr bool is_unique() noexcept
+        {
+            return true;
+        }
+
+        static KOKKOS_FUNCTION constexpr bool is_exhaustive() noexcept
+        {
+            return true;
+        }
+
+        static KOKKOS_FUNCTION constexpr bool is_strided() noexcept
+        {
+            return true;
+        }
+
+        KOKKOS_FUNCTION constexpr index_type stride(rank_type const r) const noexcept
+        {
+            return m_strides[r];
+        }
+
+        KOKKOS_FUNCTION friend constexpr bool operator==(
+                mapping const& lhs,
+                mapping const& rhs) noexcept
+        {
+            return lhs.m_extents == rhs.m_extents;
+        }
+
+        KOKKOS_FUNCTION friend constexpr bool operator!=(
+                mapping const& lhs,
+                mapping const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+};
+
+/// Each component of a `MultiChunk` in its own contiguous array
+using layout_soa = layout_aosoa<0>;
+
+template <
+        class ComponentsType,
+        class ElementType,
+        class SupportType,
+        class Allocator = HostAllocator<ElementType>,
+        class LayoutPolicy = layout_soa>
+class MultiChunk;
+
+/** A container of several fields sharing a domain, such as the components of a vector field.
+ *
+ * The components are stored in a single allocation as a `Chunk` whose first dimension is the
+ * `Components` one, `LayoutPolicy` choosing how they are blocked in memory. Each component is
+ * accessed by its tag as a `ChunkSpan` on the domain, on which the usual algorithms apply. All the
+ * components are copied at once by a `parallel_deepcopy` between the `span_view`s of two
+ * MultiChunks. Their layouts may differ, the copy is then performed element by element by a
+ * kernel running on an execution space that can access both MultiChunks.
+ */
+template <class... Tags, class ElementType, class... DDims, class Allocator, class LayoutPolicy>
+class MultiChunk<
+        Components<Tags...>,
+        ElementType,
+        DiscreteDomain<DDims...>,
+        Allocator,
+        LayoutPolicy>
+{
+public:
+    using components_type = Components<Tags...>;
+
+    using mdomain_type = DiscreteDomain<DDims...>;
+
+    /// The domain of the storage, components included
+    using storage_domain_type = DiscreteDomain<components_type, DDims...>;
+
+    using chunk_type = Chunk<ElementType, storage_domain_type, Allocator, LayoutPolicy>;
+
+    /// type of a span of all the components
+    using span_type = typename chunk_type::span_type;
+
+    /// type of a view of all the components
+    using view_type = typename chunk_type::view_type;
+
+    using memory_space = typename chunk_type::memory_space;
+
+    using layout_type = LayoutPolicy;
+
+private:
+    chunk_type m_chunk;
+
+    static storage_domain_type make_storage_domain(mdomain_type const& domain)
+    {
+        return storage_domain_type(
+                DiscreteDomain<components_type>(
+                        DiscreteElement<components_type>(0),
+                        DiscreteVector<components_type>(sizeof...(Tags))),
+                domain);
+    }
+
+public:
+    /// Empty MultiChunk
+    MultiChunk() = default;
+
+    /// Construct a labeled MultiChunk on a domain with uninitialized values
+    explicit MultiChunk(
+            std::string const& label,
+            mdomain_type const& domain,
+            Allocator allocator = Allocator())
+        : m_chunk(label, make_storage_domain(domain), std::move(allocator))
+    {
+    }
+
+    /// Construct a MultiChunk on a domain with uninitialized values
+    explicit MultiChunk(mdomain_type const& domain, Allocator allocator = Allocator())
+        : MultiChunk("no-label", domain, std::move(allocator))
+    {
+    }
+
+    /// Deleted: use deepcopy instead
+    MultiChunk(MultiChunk const& other) = delete;
+
+    MultiChunk(MultiChunk&& other) = default;
+
+    ~MultiChunk() = default;
+
+    /// Deleted: use deepcopy instead
+    MultiChunk& operator=(MultiChunk const& other) = delete;
+
+    MultiChunk& operator=(MultiChunk&& other) = default;
+
+    static constexpr std::size_t nb_components() noexcept
+    {
+        return sizeof...(Tags);
+    }
+
+    /// Index of the component `Tag` in the `Components` dimension
+    template <class Tag>
+    static constexpr DiscreteElement<components_type> component() noexcept
+    {
+        static_assert(in_tags_v<Tag, detail::TypeSeq<Tags...>>, "Unknown component");
+        return DiscreteElement<components_type>(type_seq_rank_v<Tag, detail::TypeSeq<Tags...>>);
+    }
+
+    mdomain_type domain() const noexcept
+    {
+        return select<DDims...>(m_chunk.domain());
+    }
+
+    storage_domain_type storage_domain() const noexcept
+    {
+        return m_chunk.domain();
+    }
+
+    std::string label() const
+    {
+        return m_chunk.label();
+    }
+
+    /// Modifiable span of the component `Tag`
+    template <class Tag>
+    auto get()
+    {
+        return m_chunk[component<Tag>()];
+    }
+
+    /// Read-only view of the component `Tag`
+    template <class Tag>
+    auto get() const
+    {
+        return m_chunk[component<Tag>()];
+    }
+
+    /// Modifiable span of all the components
+    span_type span_view()
+    {
+        return m_chunk.span_view();
+    }
+
+    /// Read-only view of all the components
+    view_type span_view() const
+    {
+        return m_chunk.span_cview();
+    }
+
+    /// Read-only view of all the components
+    view_type span_cview() const
+    {
+        return m_chunk.span_cview();
+    }
+
+    /** Element access to the component `Tag`
+     * @param delems discrete coordinates
+     * @return reference to this element
+     */
+    template <class Tag, class... DElems>
+    ElementType& at(DElems const&... delems)
+    {
+        return m_chunk(component<Tag>(), delems...);
+    }
+
+    /** Element access to the component `Tag`
+     * @param delems discrete coordinates
+     * @return const-reference to this element
+     */
+    template <class Tag, class... DElems>
+    ElementType const& at(DElems const&... delems) const
+    {
+        return m_chunk(component<Tag>(), delems...);
+    }
+};
+
+} // namespace ddc
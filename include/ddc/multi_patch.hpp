@@ -0,0 +1,722 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <experimental/mdspan>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc/chunk.hpp"
+#include "ddc/chunk_span.hpp"
+#include "ddc/detail/kokkos.hpp"
+#include "ddc/discrete_domain.hpp"
+#include "ddc/discrete_element.hpp"
+#include "ddc/discrete_vector.hpp"
+#include "ddc/kokkos_allocator.hpp"
+
+namespace ddc {
+
+namespace detail {
+
+/// The discrete dimension indexing the storage of a `MultiPatchChunk`
+struct MultiPatchStorage
+{
+};
+
+/// A table of trivially copyable entries, with a copy accessible from the default execution space
+template <class T>
+class DualTable
+{
+public:
+    using device_memory_space = Kokkos::DefaultExecutionSpace::memory_space;
+
+private:
+    Kokkos::View<T*, Kokkos::HostSpace> m_host;
+
+    Kokkos::View<T*, device_memory_space> m_device;
+
+public:
+    DualTable() = default;
+
+    DualTable(std::string const& label, std::vector<T> const& entries)
+        : m_host(Kokkos::view_alloc(Kokkos::WithoutInitializing, label), entries.size())
+    {
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            m_host(i) = entries[i];
+        }
+        m_device = Kokkos::create_mirror_view_and_copy(device_memory_space(), m_host);
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_host.size();
+    }
+
+    T const& operator[](std::size_t const i) const
+    {
+        return m_host(i);
+    }
+
+    /// The table accessible from `Space`, an execution or a memory space
+    template <class Space>
+    auto get() const
+    {
+        if constexpr (Kokkos::SpaceAccessibility<Space, device_memory_space>::accessible) {
+            return m_device;
+        } else {
+            static_assert(
+                    Kokkos::SpaceAccessibility<Space, Kokkos::HostSpace>::accessible,
+                    "The table is not accessible from this space");
+            return m_host;
+        }
+    }
+};
+
+template <class... DDims>
+struct Patch
+{
+    DiscreteDomain<DDims...> domain;
+
+    /// Index of the first point of the patch in the storage of a `MultiPatchChunk`
+    std::size_t offset;
+};
+
+/// Index of the last entry whose `offset` is not greater than `i`, the offsets being sorted
+template <class Table>
+KOKKOS_FUNCTION std::size_t find_entry(Table const& table, std::size_t const i)
+{
+    std::size_t low = 0;
+    std::size_t high = table.size() - 1;
+    while (low < high) {
+        std::size_t const mid = low + (high - low + 1) / 2;
+        if (table(mid).offset <= i) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return low;
+}
+
+template <class... DDims>
+KOKKOS_FUNCTION bool contains(
+        DiscreteDomain<DDims...> const& domain,
+        DiscreteElement<DDims...> const& delem)
+{
+    return ((uid<DDims>(delem) >= uid<DDims>(domain.front())
+             && uid<DDims>(delem) <= uid<DDims>(domain.back()))
+            && ...);
+}
+
+/// Whether the non-empty boxes `a` and `b` share at least one element
+template <class... DDims>
+bool overlaps(DiscreteDomain<DDims...> const& a, DiscreteDomain<DDims...> const& b)
+{
+    return ((uid<DDims>(a.front()) <= uid<DDims>(b.back())
+             && uid<DDims>(b.front()) <= uid<DDims>(a.back()))
+            && ...);
+}
+
+/// Position of `delem` in the row-major ordering of `domain`
+template <class... DDims>
+KOKKOS_FUNCTION std::size_t linear_index(
+        DiscreteDomain<DDims...> const& domain,
+        DiscreteElement<DDims...> const& delem)
+{
+    std::size_t linear = 0;
+    ((linear = linear * domain.template extent<DDims>().value()
+               + (uid<DDims>(delem) - uid<DDims>(domain.front()))),
+     ...);
+    return linear;
+}
+
+/// Element at position `linear` in the row-major ordering of `domain`
+template <class... DDims>
+KOKKOS_FUNCTION DiscreteElement<DDims...> element_at(
+        DiscreteDomain<DDims...> const& domain,
+        std::size_t linear)
+{
+    constexpr std::size_t rank = sizeof...(DDims);
+    Kokkos::Array<std::size_t, rank> const extents {
+            static_cast<std::size_t>(domain.template extent<DDims>().value())...};
+    Kokkos::Array<std::size_t, rank> idx;
+    for (std::size_t r = rank; r > 0; --r) {
+        idx[r - 1] = linear % extents[r - 1];
+        linear /= extents[r - 1];
+    }
+    return domain.front()
+           + DiscreteVector<DDims...>(static_cast<DiscreteVectorElement>(
+                   idx[type_seq_rank_v<DDims, detail::TypeSeq<DDims...>>])...);
+}
+
+template <class PatchTable, class F, class... DDims>
+class MultiPatchForEachKokkosFunctor
+{
+    PatchTable m_patches;
+
+    F m_f;
+
+public:
+    MultiPatchForEachKokkosFunctor(PatchTable const& patches, F const& f)
+        : m_patches(patches)
+        , m_f(f)
+    {
+    }
+
+    void operator()(std::size_t const i) const
+    {
+        std::size_t const p = find_entry(m_patches, i);
+        m_f(p, element_at(m_patches(p).domain, i - m_patches(p).offset));
+    }
+
+    KOKKOS_FUNCTION void operator()(use_annotated_operator, std::size_t const i) const
+    {
+        std::size_t const p = find_entry(m_patches, i);
+        m_f(p, element_at(m_patches(p).domain, i - m_patches(p).offset));
+    }
+};
+
+} // namespace detail
+
+/** A union of rectangular domains of the same discrete dimensions, the patches of a multi-block
+ * mesh.
+ *
+ * The patch table is copied to the memory of the default execution space at construction. The
+ * points of all the patches are numbered one patch after the other, which the `parallel_for_each`
+ * on a MultiPatchDomain iterates in a single launch balanced over the points rather than the
+ * patches. The patches may overlap in the index space, each one having its own storage in a
+ * `MultiPatchChunk`.
+ */
+template <class... DDims>
+class MultiPatchDomain
+{
+public:
+    using discrete_domain_type = DiscreteDomain<DDims...>;
+
+    using discrete_element_type = DiscreteElement<DDims...>;
+
+    using patch_type = detail::Patch<DDims...>;
+
+private:
+    detail::DualTable<patch_type> m_patches;
+
+    std::size_t m_size = 0;
+
+    static std::vector<patch_type> make_patches(std::vector<discrete_domain_type> const& domains)
+    {
+        if (domains.empty()) {
+            throw std::invalid_argument("A MultiPatchDomain needs at least one patch");
+        }
+        std::vector<patch_type> patches;
+        std::size_t offset = 0;
+        for (discrete_domain_type const& domain : domains) {
+            patches.push_back(patch_type {domain, offset});
+            offset += domain.size();
+        }
+        return patches;
+    }
+
+public:
+    MultiPatchDomain() = default;
+
+    /** Builds the patch table
+     * @param patches the domains of the patches, at least one
+     * @throws std::invalid_argument if `patches` is empty
+     */
+    explicit MultiPatchDomain(std::vector<discrete_domain_type> const& patches)
+        : m_patches("ddc_multi_patch_domain", make_patches(patches))
+    {
+        m_size = m_patches[nb_patches() - 1].offset + patches.back().size();
+    }
+
+    std::size_t nb_patches() const noexcept
+    {
+        return m_patches.size();
+    }
+
+    /// The total number of points of the patches
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    discrete_domain_type patch(std::size_t const p) const
+    {
+        assert(p < nb_patches());
+        return m_patches[p].domain;
+    }
+
+    /// Index of the first point of the patch `p` in the numbering of all the points
+    std::size_t offset(std::size_t const p) const
+    {
+        assert(p < nb_patches());
+        return m_patches[p].offset;
+    }
+
+    /// The patch table accessible from `Space`, an execution or a memory space
+    template <class Space>
+    auto patches() const
+    {
+        return m_patches.template get<Space>();
+    }
+};
+
+/** A view of the values of a `MultiPatchChunk`, usable in kernels
+ *
+ * The values are accessed by the index of the patch and a discrete element of this patch.
+ */
+template <class ElementType, class SupportType, class MemorySpace>
+class MultiPatchSpan;
+
+template <class ElementType, class... DDims, class MemorySpace>
+class MultiPatchSpan<ElementType, MultiPatchDomain<DDims...>, MemorySpace>
+{
+public:
+    using mdomain_type = MultiPatchDomain<DDims...>;
+
+    using discrete_domain_type = DiscreteDomain<DDims...>;
+
+    using memory_space = MemorySpace;
+
+    using element_type = ElementType;
+
+    using reference = ElementType&;
+
+    /// type of the span of a single patch
+    using patch_span_type = ChunkSpan<
+            ElementType,
+            discrete_domain_type,
+            std::experimental::layout_right,
+            MemorySpace>;
+
+    using patch_table_type
+            = decltype(std::declval<mdomain_type const&>().template patches<MemorySpace>());
+
+private:
+    ElementType* m_data = nullptr;
+
+    patch_table_type m_patches;
+
+public:
+    MultiPatchSpan() = default;
+
+    MultiPatchSpan(ElementType* const data, mdomain_type const& domain)
+        : m_data(data)
+        , m_patches(domain.template patches<MemorySpace>())
+    {
+    }
+
+    KOKKOS_FUNCTION std::size_t nb_patches() const noexcept
+    {
+        return m_patches.size();
+    }
+
+    KOKKOS_FUNCTION discrete_domain_type domain(std::size_t const p) const
+    {
+        return m_patches(p).domain;
+    }
+
+    /** Element access
+     * @param p the index of the patch
+     * @param delem a discrete element of the patch
+     * @return reference to this element
+     */
+    KOKKOS_FUNCTION reference
+    operator()(std::size_t const p, DiscreteElement<DDims...> const& delem) const
+    {
+        assert(p < nb_patches());
+        assert(detail::contains(m_patches(p).domain, delem));
+        return m_data[m_patches(p).offset + detail::linear_index(m_patches(p).domain, delem)];
+    }
+
+    /// The span of the patch `p`
+    KOKKOS_FUNCTION patch_span_type operator[](std::size_t const p) const
+    {
+        assert(p < nb_patches());
+        return patch_span_type(m_data + m_patches(p).offset, m_patches(p).domain);
+    }
+};
+
+template <class ElementType, class SupportType, class Allocator = HostAllocator<ElementType>>
+class MultiPatchChunk;
+
+/** A container of values on each patch of a `MultiPatchDomain`, in a single allocation.
+ *
+ * The values of each patch are contiguous and in the order of `layout_right`, so that each patch
+ * is viewed as a usual `ChunkSpan`.
+ */
+template <class ElementType, class... DDims, class Allocator>
+class MultiPatchChunk<ElementType, MultiPatchDomain<DDims...>, Allocator>
+{
+public:
+    using mdomain_type = MultiPatchDomain<DDims...>;
+
+    using memory_space = typename Allocator::memory_space;
+
+    using span_type = MultiPatchSpan<ElementType, mdomain_type, memory_space>;
+
+    using view_type = MultiPatchSpan<ElementType const, mdomain_type, memory_space>;
+
+private:
+    using storage_type
+            = Chunk<ElementType, DiscreteDomain<detail::MultiPatchStorage>, Allocator>;
+
+    mdomain_type m_domain;
+
+    storage_type m_storage;
+
+    static DiscreteDomain<detail::MultiPatchStorage> storage_domain(mdomain_type const& domain)
+    {
+        return DiscreteDomain<detail::MultiPatchStorage>(
+                DiscreteElement<detail::MultiPatchStorage>(0),
+                DiscreteVector<detail::MultiPatchStorage>(domain.size()));
+    }
+
+public:
+    /// Empty MultiPatchChunk
+    MultiPatchChunk() = default;
+
+    /// Construct a labeled MultiPatchChunk on a domain with uninitialized values
+    explicit MultiPatchChunk(
+            std::string const& label,
+            mdomain_type const& domain,
+            Allocator allocator = Allocator())
+        : m_domain(domain)
+        , m_storage(label, storage_domain(domain), std::move(allocator))
+    {
+    }
+
+    /// Construct a MultiPatchChunk on a domain with uninitialized values
+    explicit MultiPatchChunk(mdomain_type const& domain, Allocator allocator = Allocator())
+        : MultiPatchChunk("no-label", domain, std::move(allocator))
+    {
+    }
+
+    /// Deleted: use deepcopy instead
+    MultiPatchChunk(MultiPatchChunk const& other) = delete;
+
+    MultiPatchChunk(MultiPatchChunk&& other) = default;
+
+    ~MultiPatchChunk() = default;
+
+    /// Deleted: use deepcopy instead
+    MultiPatchChunk& operator=(MultiPatchChunk const& other) = delete;
+
+    MultiPatchChunk& operator=(MultiPatchChunk&& other) = default;
+
+    mdomain_type const& domain() const noexcept
+    {
+        return m_domain;
+    }
+
+    char const* label() const
+    {
+        return m_storage.label();
+    }
+
+    /// Modifiable span of the patch `p`
+    typename span_type::patch_span_type patch(std::size_t const p)
+    {
+        return typename span_type::patch_span_type(
+                m_storage.data_handle() + m_domain.offset(p),
+                m_domain.patch(p));
+    }
+
+    /// Read-only view of the patch `p`
+    typename view_type::patch_span_type patch(std::size_t const p) const
+    {
+        return typename view_type::patch_span_type(
+                m_storage.data_handle() + m_domain.offset(p),
+                m_domain.patch(p));
+    }
+
+    /// Modifiable span of all the patches
+    span_type span_view()
+    {
+        return span_type(m_storage.data_handle(), m_domain);
+    }
+
+    /// Read-only view of all the patches
+    view_type span_view() const
+    {
+        return view_type(m_storage.data_handle(), m_domain);
+    }
+
+    /// Read-only view of all the patches
+    view_type span_cview() const
+    {
+        return view_type(m_storage.data_handle(), m_domain);
+    }
+};
+
+/** iterates over all the patches of a domain in a single launch using a given `Kokkos` execution
+ * space
+ * @param[in] label  name for easy identification of the parallel_for_each algorithm
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] domain the multi-patch domain over which to iterate
+ * @param[in] f      a functor taking the index of a patch and an element of it as parameters
+ */
+template <class ExecSpace, class... DDims, class Functor>
+void parallel_for_each(
+        std::string const& label,
+        ExecSpace const& execution_space,
+        MultiPatchDomain<DDims...> const& domain,
+        Functor&& f) noexcept
+{
+    auto const patches = domain.template patches<ExecSpace>();
+    using functor_type = detail::MultiPatchForEachKokkosFunctor<
+            std::remove_const_t<decltype(patches)>,
+            std::decay_t<Functor>,
+            DDims...>;
+    if constexpr (detail::need_annotated_operator<ExecSpace>()) {
+        Kokkos::parallel_for(
+                label,
+                Kokkos::RangePolicy<
+                        ExecSpace,
+                        Kokkos::IndexType<std::size_t>,
+                        detail::use_annotated_operator>(execution_space, 0, domain.size()),
+                functor_type(patches, f));
+    } else {
+        Kokkos::parallel_for(
+                label,
+                Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<std::size_t>>(
+                        execution_space,
+                        0,
+                        domain.size()),
+                functor_type(patches, f));
+    }
+}
+
+/** iterates over all the patches of a domain in a single launch using a given `Kokkos` execution
+ * space
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] domain the multi-patch domain over which to iterate
+ * @param[in] f      a functor taking the index of a patch and an element of it as parameters
+ */
+template <class ExecSpace, class... DDims, class Functor>
+std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>> parallel_for_each(
+        ExecSpace const& execution_space,
+        MultiPatchDomain<DDims...> const& domain,
+        Functor&& f) noexcept
+{
+    parallel_for_each(
+            "ddc_for_each_default",
+            execution_space,
+            domain,
+            std::forward<Functor>(f));
+}
+
+/** iterates over all the patches of a domain in a single launch using the `Kokkos` default
+ * execution space
+ * @param[in] label  name for easy identification of the parallel_for_each algorithm
+ * @param[in] domain the multi-patch domain over which to iterate
+ * @param[in] f      a functor taking the index of a patch and an element of it as parameters
+ */
+template <class... DDims, class Functor>
+void parallel_for_each(
+        std::string const& label,
+        MultiPatchDomain<DDims...> const& domain,
+        Functor&& f) noexcept
+{
+    parallel_for_each(label, Kokkos::DefaultExecutionSpace(), domain, std::forward<Functor>(f));
+}
+
+/** iterates over all the patches of a domain in a single launch using the `Kokkos` default
+ * execution space
+ * @param[in] domain the multi-patch domain over which to iterate
+ * @param[in] f      a functor taking the index of a patch and an element of it as parameters
+ */
+template <class... DDims, class Functor>
+void parallel_for_each(MultiPatchDomain<DDims...> const& domain, Functor&& f) noexcept
+{
+    parallel_for_each(
+            "ddc_for_each_default",
+            Kokkos::DefaultExecutionSpace(),
+            domain,
+            std::forward<Functor>(f));
+}
+
+/// Boxes of two patches of the same shape, the values of the source being copied to the destination
+template <class... DDims>
+struct PatchInterface
+{
+    std::size_t source_patch;
+
+    DiscreteDomain<DDims...> source;
+
+    std::size_t destination_patch;
+
+    DiscreteDomain<DDims...> destination;
+};
+
+namespace detail {
+
+template <class... DDims>
+struct PatchCopy
+{
+    PatchInterface<DDims...> patch_interface;
+
+    /// Index of the first point of the destination box in the points of all the interfaces
+    std::size_t offset;
+};
+
+template <class Span, class CopyTable>
+class MultiPatchHaloKokkosFunctor
+{
+    Span m_data;
+
+    CopyTable m_copies;
+
+public:
+    MultiPatchHaloKokkosFunctor(Span const& data, CopyTable const& copies)
+        : m_data(data)
+        , m_copies(copies)
+    {
+    }
+
+    KOKKOS_FUNCTION void operator()(std::size_t const i) const
+    {
+        auto const& copy = m_copies(find_entry(m_copies, i));
+        auto const& boxes = copy.patch_interface;
+        auto const destination = element_at(boxes.destination, i - copy.offset);
+        auto const source = boxes.source.front() + (destination - boxes.destination.front());
+        m_data(boxes.destination_patch, destination) = m_data(boxes.source_patch, source);
+    }
+};
+
+} // namespace detail
+
+/** Copies values between the patches of a `MultiPatchChunk`, e.g. to fill the ghost points of a
+ * patch from the interior points of its neighbours.
+ *
+ * The interfaces are copied to the memory of the default execution space once at construction and
+ * all of them are applied by a single kernel. The patches must have the same orientation, and no
+ * destination box may overlap a source box.
+ */
+template <class... DDims>
+class MultiPatchHaloExchange
+{
+public:
+    using mdomain_type = MultiPatchDomain<DDims...>;
+
+    using interface_type = PatchInterface<DDims...>;
+
+private:
+    using copy_type = detail::PatchCopy<DDims...>;
+
+    mdomain_type m_domain;
+
+    detail::DualTable<copy_type> m_copies;
+
+    std::size_t m_size = 0;
+
+    static std::vector<copy_type> make_copies(std::vector<interface_type> const& interfaces)
+    {
+        std::vector<copy_type> copies;
+        std::size_t offset = 0;
+        for (interface_type const& patch_interface : interfaces) {
+            assert(patch_interface.source.extents() == patch_interface.destination.extents());
+            copies.push_back(copy_type {patch_interface, offset});
+            offset += patch_interface.destination.size();
+        }
+        return copies;
+    }
+
+public:
+    /** Precomputes the copies of the interfaces
+     * @param domain the multi-patch domain of the chunks to update
+     * @param interfaces the boxes to copy, each one inside its patch
+     */
+    MultiPatchHaloExchange(
+            mdomain_type const& domain,
+            std::vector<interface_type> const& interfaces)
+        : m_domain(domain)
+        , m_copies("ddc_multi_patch_halo_exchange", make_copies(interfaces))
+    {
+        for (interface_type const& patch_interface : interfaces) {
+            assert(patch_interface.source_patch < domain.nb_patches());
+            assert(patch_interface.destination_patch < domain.nb_patches());
+            assert(detail::contains(
+                    domain.patch(patch_interface.source_patch),
+                    patch_interface.source.front()));
+            assert(detail::contains(
+                    domain.patch(patch_interface.source_patch),
+                    patch_interface.source.back()));
+            assert(detail::contains(
+                    domain.patch(patch_interface.destination_patch),
+                    patch_interface.destination.front()));
+            assert(detail::contains(
+                    domain.patch(patch_interface.destination_patch),
+                    patch_interface.destination.back()));
+            m_size += patch_interface.destination.size();
+        }
+        // The kernel would read points written by other threads
+        for ([[maybe_unused]] interface_type const& destination : interfaces) {
+            for ([[maybe_unused]] interface_type const& source : interfaces) {
+                assert(destination.destination_patch != source.source_patch
+                       || !detail::overlaps(destination.destination, source.source));
+            }
+        }
+    }
+
+    std::size_t nb_interfaces() const noexcept
+    {
+        return m_copies.size();
+    }
+
+    /// Total number of copied points
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    /** Copies the values of the source boxes to the destination boxes
+     * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+     * @param[inout] data a span of a MultiPatchChunk on the multi-patch domain
+     */
+    template <class ExecSpace, class ElementType, class MemorySpace>
+    void operator()(
+            ExecSpace const& execution_space,
+            MultiPatchSpan<ElementType, mdomain_type, MemorySpace> const& data) const
+    {
+        static_assert(
+                Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
+                "The execution space must be able to access the memory of the chunk");
+        assert(data.nb_patches() == m_domain.nb_patches());
+        if (m_size == 0) {
+            return;
+        }
+        auto const copies = m_copies.template get<ExecSpace>();
+        Kokkos::parallel_for(
+                "ddc_multi_patch_halo_exchange",
+                Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<std::size_t>>(
+                        execution_space,
+                        0,
+                        m_size),
+                detail::MultiPatchHaloKokkosFunctor<
+                        MultiPatchSpan<ElementType, mdomain_type, MemorySpace>,
+                        std::remove_const_t<decltype(copies)>>(data, copies));
+    }
+
+    /** Copies the values of the source boxes to the destination boxes using the `Kokkos` default
+     * execution space
+     * @param[inout] data a span of a MultiPatchChunk on the multi-patch domain
+     */
+    template <class ElementType, class MemorySpace>
+    void operator()(MultiPatchSpan<ElementType, mdomain_type, MemorySpace> const& data) const
+    {
+        (*this)(Kokkos::DefaultExecutionSpace(), data);
+    }
+};
+
+} // namespace ddc
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <initializer_list>
 #include <ostream>
+#include <stdexcept>
 #include <type_traits>
 #include <vector>
 
@@ -17,6 +18,7 @@
 #include "ddc/discrete_element.hpp"
 #include "ddc/discrete_space.hpp"
 #include "ddc/discrete_vector.hpp"
+#include "ddc/real_type.hpp"
 
 namespace ddc {
 
@@ -26,6 +28,89 @@ struct NonUniformPointSamplingBase
 {
 };
 
+template <class PointsView, class Generator>
+class GeneratePointsKokkosFunctor
+{
+    PointsView m_points;
+
+    Generator m_generator;
+
+public:
+    GeneratePointsKokkosFunctor(PointsView const& points, Generator const& generator)
+        : m_points(points)
+        , m_generator(generator)
+    {
+    }
+
+    KOKKOS_FUNCTION void operator()(std::size_t const i) const
+    {
+        m_points(i) = typename PointsView::non_const_value_type(m_generator(i));
+    }
+};
+
+/// Counts the points that are not strictly greater than the previous one
+template <class PointsView>
+class CountUnorderedPointsKokkosFunctor
+{
+    PointsView m_points;
+
+public:
+    explicit CountUnorderedPointsKokkosFunctor(PointsView const& points) : m_points(points) {}
+
+    KOKKOS_FUNCTION void operator()(std::size_t const i, std::size_t& count) const
+    {
+        if (!(m_points(i - 1) < m_points(i))) {
+            ++count;
+        }
+    }
+};
+
+/// The first cell intersecting each bucket of a uniform partition of the points
+template <class BucketsView, class PointsView>
+class BuildBucketsKokkosFunctor
+{
+    BucketsView m_buckets;
+
+    PointsView m_points;
+
+    Real m_origin;
+
+    Real m_width;
+
+    std::size_t m_nb_buckets;
+
+public:
+    BuildBucketsKokkosFunctor(
+            BucketsView const& buckets,
+            PointsView const& points,
+            Real const origin,
+            Real const width)
+        : m_buckets(buckets)
+        , m_points(points)
+        , m_origin(origin)
+        , m_width(width)
+        , m_nb_buckets(buckets.size() - 1)
+    {
+    }
+
+    KOKKOS_FUNCTION void operator()(std::size_t const b) const
+    {
+        Real const bucket_start = m_origin + b * m_width / m_nb_buckets;
+        // Binary search of the last cell starting before the bucket
+        std::size_t low = 0;
+        std::size_t high = m_points.size() - 2;
+        while (low < high) {
+            std::size_t const mid = low + (high - low + 1) / 2;
+            if (Real(m_points(mid)) <= bucket_start) {
+                low = mid;
+            } else {
+                high = mid - 1;
+            }
+        }
+        m_buckets(b) = low;
+    }
+};
+
 } // namespace detail
 
 /// `NonUniformPointSampling` models a non-uniform discretization of the `CDim` segment \f$[a, b]\f$.
@@ -49,6 +134,71 @@ public:
 
         Kokkos::View<continuous_element_type*, MemorySpace> m_points;
 
+        /// For each bucket of a uniform partition of the points, the first cell intersecting it
+        Kokkos::View<DiscreteElementType*, MemorySpace> m_buckets;
+
+        Real m_bucket_origin = 0;
+
+        Real m_inv_bucket_step = 0;
+
+        /// Width of each cell, only allocated by `compute_metrics`
+        Kokkos::View<Real*, MemorySpace> m_cell_widths;
+
+        /// Inverse of the width of each cell, only allocated by `compute_metrics`
+        Kokkos::View<Real*, MemorySpace> m_inv_cell_widths;
+
+        /// Distance between the midpoints of the cells around each point, only allocated by
+        /// `compute_metrics`
+        Kokkos::View<Real*, MemorySpace> m_midpoint_spacings;
+
+        /** Partitions the points into `size() - 1` buckets of equal length for `find_cell`, the
+         * buckets being computed in parallel in `exec_space` from `points`, accessible from it
+         */
+        template <class ExecSpace, class PointsView>
+        void build_buckets(ExecSpace const& exec_space, PointsView const& points)
+        {
+            std::size_t const n = points.size();
+            if (n < 2) {
+                return;
+            }
+            continuous_element_type first;
+            continuous_element_type last;
+            Kokkos::deep_copy(first, Kokkos::subview(points, 0));
+            Kokkos::deep_copy(last, Kokkos::subview(points, n - 1));
+            std::size_t const nb_buckets = n - 1;
+            m_bucket_origin = first;
+            Real const width = last - first;
+            m_inv_bucket_step = width > 0 ? nb_buckets / width : 0;
+            using buckets_type
+                    = Kokkos::View<DiscreteElementType*, typename ExecSpace::memory_space>;
+            buckets_type const buckets(
+                    Kokkos::view_alloc(
+                            exec_space,
+                            Kokkos::WithoutInitializing,
+                            "ddc_non_uniform_point_sampling_buckets"),
+                    nb_buckets + 1);
+            Kokkos::parallel_for(
+                    "ddc_non_uniform_point_sampling_buckets",
+                    Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<std::size_t>>(
+                            exec_space,
+                            0,
+                            nb_buckets + 1),
+                    detail::BuildBucketsKokkosFunctor<buckets_type, PointsView>(
+                            buckets,
+                            points,
+                            m_bucket_origin,
+                            width));
+            m_buckets = Kokkos::create_mirror_view_and_copy(MemorySpace(), buckets);
+        }
+
+        /// Partitions the points into buckets on the host
+        void build_buckets()
+        {
+            build_buckets(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m_points));
+        }
+
     public:
         using discrete_dimension_type = NonUniformPointSampling;
 
@@ -68,6 +218,7 @@ public:
                     host(host_points.data(), host_points.size());
             Kokkos::resize(m_points, host.extent(0));
             Kokkos::deep_copy(m_points, host);
+            build_buckets();
         }
 
         /// @brief Construct a `NonUniformPointSampling` using a C++20 "common range".
@@ -75,6 +226,7 @@ public:
         explicit Impl(InputRange const& points)
         {
             if constexpr (Kokkos::is_view<InputRange>::value) {
+                Kokkos::resize(m_points, points.extent(0));
                 Kokkos::deep_copy(m_points, points);
             } else {
                 std::vector<continuous_element_type> host_points(points.begin(), points.end());
@@ -83,6 +235,7 @@ public:
                 Kokkos::resize(m_points, host.extent(0));
                 Kokkos::deep_copy(m_points, host);
             }
+            build_buckets();
         }
 
         /// @brief Construct a `NonUniformPointSampling` using a pair of iterators.
@@ -94,14 +247,91 @@ public:
                     host(host_points.data(), host_points.size());
             Kokkos::resize(m_points, host.extent(0));
             Kokkos::deep_copy(m_points, host);
+            build_buckets();
+        }
+
+        /** @brief Construct a `NonUniformPointSampling` from the points `generator(i)`, `i` in
+         * \f$[0, n[\f$, computed in parallel in `exec_space`.
+         *
+         * The points are generated, checked to be strictly increasing and partitioned into the
+         * buckets of `find_cell` in the memory space of `exec_space`, then copied once to this
+         * sampling.
+         * @throws std::runtime_error if the points are not strictly increasing
+         */
+        template <
+                class ExecSpace,
+                class Generator,
+                std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>, bool> = true>
+        Impl(ExecSpace const& exec_space, Generator const& generator, std::size_t const n)
+        {
+            using points_type
+                    = Kokkos::View<continuous_element_type*, typename ExecSpace::memory_space>;
+            using policy_type = Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<std::size_t>>;
+            points_type const points(
+                    Kokkos::view_alloc(
+                            exec_space,
+                            Kokkos::WithoutInitializing,
+                            "ddc_non_uniform_point_sampling_points"),
+                    n);
+            Kokkos::parallel_for(
+                    "ddc_non_uniform_point_sampling_generate",
+                    policy_type(exec_space, 0, n),
+                    detail::GeneratePointsKokkosFunctor<points_type, Generator>(points, generator));
+            if (n > 1) {
+                std::size_t nb_unordered = 0;
+                Kokkos::parallel_reduce(
+                        "ddc_non_uniform_point_sampling_check",
+                        policy_type(exec_space, 1, n),
+                        detail::CountUnorderedPointsKokkosFunctor<points_type>(points),
+                        nb_unordered);
+                if (nb_unordered > 0) {
+                    throw std::runtime_error(
+                            "NonUniformPointSampling: the points are not strictly increasing");
+                }
+            }
+            build_buckets(exec_space, points);
+            m_points = Kokkos::create_mirror_view_and_copy(MemorySpace(), points);
         }
 
         template <class OriginMemorySpace>
         explicit Impl(Impl<DDim, OriginMemorySpace> const& impl)
             : m_points(Kokkos::create_mirror_view_and_copy(MemorySpace(), impl.m_points))
+            , m_buckets(Kokkos::create_mirror_view_and_copy(MemorySpace(), impl.m_buckets))
+            , m_bucket_origin(impl.m_bucket_origin)
+            , m_inv_bucket_step(impl.m_inv_bucket_step)
+            , m_cell_widths(Kokkos::create_mirror_view_and_copy(MemorySpace(), impl.m_cell_widths))
+            , m_inv_cell_widths(
+                      Kokkos::create_mirror_view_and_copy(MemorySpace(), impl.m_inv_cell_widths))
+            , m_midpoint_spacings(
+                      Kokkos::create_mirror_view_and_copy(MemorySpace(), impl.m_midpoint_spacings))
         {
         }
 
+        /** @brief Copy the points and the metrics of `impl` into the storage of this sampling
+         *
+         * It allows `reinit_discrete_space` to move the points while reusing the storage of the
+         * existing instances.
+         * @return false, leaving this sampling unchanged, if the sizes of the storages differ
+         */
+        template <class OriginMemorySpace>
+        bool assign(Impl<DDim, OriginMemorySpace> const& impl)
+        {
+            if (m_points.size() != impl.m_points.size()
+                || m_buckets.size() != impl.m_buckets.size()
+                || m_cell_widths.size() != impl.m_cell_widths.size()
+                || m_midpoint_spacings.size() != impl.m_midpoint_spacings.size()) {
+                return false;
+            }
+            Kokkos::deep_copy(m_points, impl.m_points);
+            Kokkos::deep_copy(m_buckets, impl.m_buckets);
+            m_bucket_origin = impl.m_bucket_origin;
+            m_inv_bucket_step = impl.m_inv_bucket_step;
+            Kokkos::deep_copy(m_cell_widths, impl.m_cell_widths);
+            Kokkos::deep_copy(m_inv_cell_widths, impl.m_inv_cell_widths);
+            Kokkos::deep_copy(m_midpoint_spacings, impl.m_midpoint_spacings);
+            return true;
+        }
+
         Impl(Impl const& x) = delete;
 
         Impl(Impl&& x) = default;
@@ -113,6 +343,71 @@ public:
             return m_points.size();
         }
 
+        /// The coordinates of the points, in `MemorySpace`
+        KOKKOS_FUNCTION Kokkos::View<continuous_element_type*, MemorySpace> const& points() const
+        {
+            return m_points;
+        }
+
+        /** @brief Precompute the widths of the cells, their inverses and the midpoint spacings
+         *
+         * The distances between points then cost a single load, e.g. in finite difference
+         * stencils. It is to be called on the host sampling before `init_discrete_space`.
+         */
+        void compute_metrics()
+        {
+            auto const points = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m_points);
+            std::size_t const n = points.size();
+            if (n < 2) {
+                return;
+            }
+            Kokkos::View<Real*, Kokkos::HostSpace>
+                    widths("ddc_non_uniform_point_sampling_cell_widths", n - 1);
+            Kokkos::View<Real*, Kokkos::HostSpace>
+                    inv_widths("ddc_non_uniform_point_sampling_inv_cell_widths", n - 1);
+            Kokkos::View<Real*, Kokkos::HostSpace>
+                    midpoint_spacings("ddc_non_uniform_point_sampling_midpoint_spacings", n);
+            for (std::size_t i = 0; i < n - 1; ++i) {
+                widths(i) = points(i + 1) - points(i);
+                inv_widths(i) = 1 / widths(i);
+            }
+            // The dual cells of the boundary points are cut at the boundary
+            for (std::size_t i = 0; i < n; ++i) {
+                Real const left = i > 0 ? widths(i - 1) : 0;
+                Real const right = i < n - 1 ? widths(i) : 0;
+                midpoint_spacings(i) = (left + right) / 2;
+            }
+            m_cell_widths = Kokkos::create_mirror_view_and_copy(MemorySpace(), widths);
+            m_inv_cell_widths = Kokkos::create_mirror_view_and_copy(MemorySpace(), inv_widths);
+            m_midpoint_spacings
+                    = Kokkos::create_mirror_view_and_copy(MemorySpace(), midpoint_spacings);
+        }
+
+        /// @brief True if `compute_metrics` was called
+        KOKKOS_FUNCTION bool has_metrics() const noexcept
+        {
+            return m_cell_widths.size() > 0;
+        }
+
+        /// @brief Width of each cell \f$[x_i, x_{i+1}]\f$, empty without `compute_metrics`
+        KOKKOS_FUNCTION Kokkos::View<Real const*, MemorySpace> cell_widths() const noexcept
+        {
+            return m_cell_widths;
+        }
+
+        /// @brief Inverse of the width of each cell, empty without `compute_metrics`
+        KOKKOS_FUNCTION Kokkos::View<Real const*, MemorySpace> inv_cell_widths() const noexcept
+        {
+            return m_inv_cell_widths;
+        }
+
+        /// @brief Distance between the midpoints of the cells around each point, the boundary
+        /// points only counting their inner half cell, empty without `compute_metrics`
+        KOKKOS_FUNCTION Kokkos::View<Real const*, MemorySpace> midpoint_spacings() const noexcept
+        {
+            return m_midpoint_spacings;
+        }
+
         /// @brief Lower bound index of the mesh
         KOKKOS_FUNCTION discrete_element_type front() const noexcept
         {
@@ -125,6 +420,93 @@ public:
         {
             return m_points(icoord.uid());
         }
+
+        /// @brief Distance between the point `icoord` and the previous one
+        KOKKOS_FUNCTION Real distance_at_left(discrete_element_type const& icoord) const noexcept
+        {
+            if (has_metrics()) {
+                return m_cell_widths(icoord.uid() - 1);
+            }
+            return coordinate(icoord) - coordinate(icoord - 1);
+        }
+
+        /// @brief Distance between the point `icoord` and the next one
+        KOKKOS_FUNCTION Real distance_at_right(discrete_element_type const& icoord) const noexcept
+        {
+            if (has_metrics()) {
+                return m_cell_widths(icoord.uid());
+            }
+            return coordinate(icoord + 1) - coordinate(icoord);
+        }
+
+        /// @brief Inverse of the distance between the point `icoord` and the previous one
+        KOKKOS_FUNCTION Real
+        inv_distance_at_left(discrete_element_type const& icoord) const noexcept
+        {
+            if (has_metrics()) {
+                return m_inv_cell_widths(icoord.uid() - 1);
+            }
+            return 1 / distance_at_left(icoord);
+        }
+
+        /// @brief Inverse of the distance between the point `icoord` and the next one
+        KOKKOS_FUNCTION Real
+        inv_distance_at_right(discrete_element_type const& icoord) const noexcept
+        {
+            if (has_metrics()) {
+                return m_inv_cell_widths(icoord.uid());
+            }
+            return 1 / distance_at_right(icoord);
+        }
+
+        /// @brief Distance between the midpoints of the cells around the interior point `icoord`
+        KOKKOS_FUNCTION Real midpoint_spacing(discrete_element_type const& icoord) const noexcept
+        {
+            if (has_metrics()) {
+                return m_midpoint_spacings(icoord.uid());
+            }
+            return (coordinate(icoord + 1) - coordinate(icoord - 1)) / 2;
+        }
+
+        /** @brief Convert a position in `CDim` into the index of the cell containing it
+         *
+         * The cell `i` is \f$[x_i, x_{i+1}[\f$, the last one also contains the last point. The
+         * positions outside of the points are attributed to the first or the last cell. The
+         * search is restricted to the cells intersecting the bucket of `x`.
+         */
+        KOKKOS_FUNCTION discrete_element_type
+        find_cell(continuous_element_type const& x) const noexcept
+        {
+            std::size_t const n = m_points.size();
+            if (n < 2) {
+                return front();
+            }
+            std::size_t const last_cell = n - 2;
+            std::size_t const nb_buckets = m_buckets.size() - 1;
+            Real const t = (Real(x) - m_bucket_origin) * m_inv_bucket_step;
+            std::size_t const b = t <= 0            ? 0
+                                  : t >= nb_buckets ? nb_buckets - 1
+                                                    : static_cast<std::size_t>(t);
+            // Binary search of the last point before `x` in the bucket
+            std::size_t low = m_buckets(b);
+            std::size_t high = m_buckets(b + 1);
+            while (low < high) {
+                std::size_t const mid = low + (high - low + 1) / 2;
+                if (x < m_points(mid)) {
+                    high = mid - 1;
+                } else {
+                    low = mid;
+                }
+            }
+            // Compensate the rounding errors of the bucket computation
+            while (low > 0 && x < m_points(low)) {
+                --low;
+            }
+            while (low < last_cell && !(x < m_points(low + 1))) {
+                ++low;
+            }
+            return discrete_element_type(low);
+        }
     };
 
     /** Construct an Impl<Kokkos::HostSpace> and associated discrete_domain_type from an iterator
@@ -146,6 +528,44 @@ public:
         return std::make_tuple(std::move(disc), std::move(domain));
     }
 
+    /** Construct an Impl<Kokkos::HostSpace> and associated discrete_domain_type from a generator
+     * of the points coordinates along the `DDim` dimension, evaluated in parallel.
+     *
+     * @param exec_space the execution space generating and checking the points
+     * @param generator a function object returning the coordinate of the point `i`, a
+     * `std::size_t`, callable from `exec_space`
+     * @param n the number of points
+     */
+    template <
+            class DDim,
+            class ExecSpace,
+            class Generator,
+            std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>, bool> = true>
+    static std::tuple<typename DDim::template Impl<DDim, Kokkos::HostSpace>, DiscreteDomain<DDim>>
+    init(ExecSpace const& exec_space, Generator const& generator, DiscreteVector<DDim> n)
+    {
+        assert(n > 0);
+        typename DDim::template Impl<DDim, Kokkos::HostSpace>
+                disc(exec_space, generator, n.value());
+        DiscreteDomain<DDim> domain {disc.front(), n};
+        return std::make_tuple(std::move(disc), std::move(domain));
+    }
+
+    /** Construct an Impl<Kokkos::HostSpace> and associated discrete_domain_type from a generator
+     * of the points coordinates along the `DDim` dimension, evaluated in parallel on the default
+     * execution space.
+     *
+     * @param generator a function object returning the coordinate of the point `i`, a
+     * `std::size_t`, callable from the default execution space
+     * @param n the number of points
+     */
+    template <class DDim, class Generator>
+    static std::tuple<typename DDim::template Impl<DDim, Kokkos::HostSpace>, DiscreteDomain<DDim>>
+    init(Generator const& generator, DiscreteVector<DDim> n)
+    {
+        return init<DDim>(Kokkos::DefaultExecutionSpace(), generator, n);
+    }
+
     /** Construct 4 non-uniform `DiscreteDomain` and an Impl<Kokkos::HostSpace> from 3 iterators containing the points coordinates along the `DDim` dimension.
      *
      * @param domain_r an iterator containing the coordinates of the points of the main domain along the DDim position
@@ -226,18 +646,49 @@ KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> coordinate(
     return discrete_space<DDim>().coordinate(c);
 }
 
+/// @brief Index of the cell containing `x`, the cell `i` being \f$[x_i, x_{i+1}[\f$
+template <class DDim, std::enable_if_t<is_non_uniform_point_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION DiscreteElement<DDim> find_cell(
+        Coordinate<typename DDim::continuous_dimension_type> const& x)
+{
+    return discrete_space<DDim>().find_cell(x);
+}
+
 template <class DDim, std::enable_if_t<is_non_uniform_point_sampling_v<DDim>, int> = 0>
 KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> distance_at_left(
         DiscreteElement<DDim> i)
 {
-    return coordinate(i) - coordinate(i - 1);
+    return Coordinate<typename DDim::continuous_dimension_type>(
+            discrete_space<DDim>().distance_at_left(i));
 }
 
 template <class DDim, std::enable_if_t<is_non_uniform_point_sampling_v<DDim>, int> = 0>
 KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> distance_at_right(
         DiscreteElement<DDim> i)
 {
-    return coordinate(i + 1) - coordinate(i);
+    return Coordinate<typename DDim::continuous_dimension_type>(
+            discrete_space<DDim>().distance_at_right(i));
+}
+
+/// @brief Inverse of the distance between the point `i` and the previous one
+template <class DDim, std::enable_if_t<is_non_uniform_point_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION Real inv_distance_at_left(DiscreteElement<DDim> i)
+{
+    return discrete_space<DDim>().inv_distance_at_left(i);
+}
+
+/// @brief Inverse of the distance between the point `i` and the next one
+template <class DDim, std::enable_if_t<is_non_uniform_point_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION Real inv_distance_at_right(DiscreteElement<DDim> i)
+{
+    return discrete_space<DDim>().inv_distance_at_right(i);
+}
+
+/// @brief Distance between the midpoints of the cells around the interior point `i`
+template <class DDim, std::enable_if_t<is_non_uniform_point_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION Real midpoint_spacing(DiscreteElement<DDim> i)
+{
+    return discrete_space<DDim>().midpoint_spacing(i);
 }
 
 template <class DDim, std::enable_if_t<is_non_uniform_point_sampling_v<DDim>, int> = 0>
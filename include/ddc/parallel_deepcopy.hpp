@@ -4,15 +4,218 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <type_traits>
 
 #include <Kokkos_Core.hpp>
 
 #include "ddc/chunk_traits.hpp"
+#include "ddc/detail/kokkos.hpp"
+#include "ddc/detail/type_seq.hpp"
+#include "ddc/discrete_domain.hpp"
+#include "ddc/layout_right_padded.hpp"
+#include "ddc/parallel_for_each.hpp"
 
 namespace ddc {
 
+namespace detail {
+
+/// Chunks sharing the same non-standard layout and extents are copied as flat spans, padding
+/// included. Kokkos is then able to copy them across memory spaces, which is not the case of
+/// strided views.
+template <class ChunkDst, class ChunkSrc>
+inline constexpr bool is_flat_copyable_v
+        = !is_submdspan_layout_v<typename std::remove_reference_t<ChunkDst>::layout_type>
+          && std::is_same_v<
+                  typename std::remove_reference_t<ChunkDst>::layout_type,
+                  typename std::remove_reference_t<ChunkSrc>::layout_type>;
+
+/// Whether the chunks store different types, e.g. a `ConvertingSpan` on floats and doubles
+template <class ChunkDst, class ChunkSrc>
+inline constexpr bool is_converting_copy_v
+        = !std::is_same_v<chunk_value_t<ChunkDst>, chunk_value_t<ChunkSrc>>;
+
+/// Whether both chunks have a layout with a Kokkos counterpart, so that they can be copied as views
+template <class ChunkDst, class ChunkSrc>
+inline constexpr bool is_kokkos_copyable_v
+        = has_kokkos_layout_v<typename std::remove_reference_t<ChunkDst>::layout_type>
+          && has_kokkos_layout_v<typename std::remove_reference_t<ChunkSrc>::layout_type>;
+
+template <class ChunkType>
+auto flat_kokkos_view(ChunkType& chunk)
+{
+    return Kokkos::View<
+            std::remove_pointer_t<decltype(chunk.data_handle())>*,
+            typename std::remove_reference_t<ChunkType>::memory_space,
+            Kokkos::MemoryTraits<Kokkos::Unmanaged>>(
+            chunk.data_handle(),
+            chunk.mapping().required_span_size());
+}
+
+template <class ChunkDst, class ChunkSrc>
+inline constexpr bool is_permuted_copy_v = !std::is_same_v<
+        typename std::remove_reference_t<ChunkDst>::mdomain_type,
+        typename std::remove_reference_t<ChunkSrc>::mdomain_type>;
+
+/// Edge of the host tiles of a permuted copy, a tile of 32x32 doubles fits in the L1 cache
+inline constexpr std::size_t permuted_copy_tile_size = 32;
+
+template <class DstMdspan, class SrcMdspan, class DstTypeSeq, class SrcTypeSeq>
+class PermutedCopyKokkosFunctor;
+
+template <class DstMdspan, class SrcMdspan, class... DstDDims, class... SrcDDims>
+class PermutedCopyKokkosFunctor<DstMdspan, SrcMdspan, TypeSeq<DstDDims...>, TypeSeq<SrcDDims...>>
+{
+    template <class T>
+    using index_type = typename DstMdspan::index_type;
+
+    DstMdspan m_dst;
+
+    SrcMdspan m_src;
+
+public:
+    PermutedCopyKokkosFunctor(DstMdspan const& dst, SrcMdspan const& src) : m_dst(dst), m_src(src)
+    {
+    }
+
+    KOKKOS_FUNCTION void operator()(index_type<DstDDims>... ids) const
+    {
+        std::array<index_type<void>, sizeof...(DstDDims)> const dst_ids {ids...};
+        m_dst(ids...) = m_src(dst_ids[type_seq_rank_v<SrcDDims, TypeSeq<DstDDims...>>]...);
+    }
+};
+
+/** Copies between chunks whose domains are permutations of one another.
+ * The iteration follows the layout of `dst` and, on the host, is blocked over the innermost
+ * dimensions of both chunks so that the strided side of the copy stays in cache.
+ */
+template <class ExecSpace, class DstMdspan, class... DstDDims, class SrcMdspan, class... SrcDDims>
+void permuted_deepcopy(
+        ExecSpace const& execution_space,
+        DstMdspan const& dst,
+        [[maybe_unused]] DiscreteDomain<DstDDims...> const& dst_domain,
+        SrcMdspan const& src,
+        [[maybe_unused]] DiscreteDomain<SrcDDims...> const& src_domain)
+{
+    static_assert(sizeof...(DstDDims) >= 2, "A permuted copy involves at least two dimensions");
+    using dst_ddims = TypeSeq<DstDDims...>;
+    using src_innermost_ddim = type_seq_element_t<sizeof...(SrcDDims) - 1, TypeSeq<SrcDDims...>>;
+    using policy_type = Kokkos::MDRangePolicy<
+            ExecSpace,
+            Kokkos::Rank<sizeof...(DstDDims), Kokkos::Iterate::Right, Kokkos::Iterate::Right>>;
+    Kokkos::Array<std::size_t, sizeof...(DstDDims)> const begin {};
+    Kokkos::Array<std::size_t, sizeof...(DstDDims)> const end {
+            dst.extent(type_seq_rank_v<DstDDims, dst_ddims>)...};
+    PermutedCopyKokkosFunctor<DstMdspan, SrcMdspan, dst_ddims, TypeSeq<SrcDDims...>> const
+            functor(dst, src);
+    if constexpr (Kokkos::SpaceAccessibility<ExecSpace, Kokkos::HostSpace>::accessible) {
+        typename policy_type::tile_type const tiles {static_cast<typename policy_type::index_type>(
+                type_seq_rank_v<DstDDims, dst_ddims> == sizeof...(DstDDims) - 1
+                                || std::is_same_v<DstDDims, src_innermost_ddim>
+                        ? permuted_copy_tile_size
+                        : 1)...};
+        Kokkos::parallel_for(
+                "ddc_permuted_deepcopy",
+                policy_type(execution_space, begin, end, tiles),
+                functor);
+    } else {
+        Kokkos::parallel_for(
+                "ddc_permuted_deepcopy",
+                policy_type(execution_space, begin, end),
+                functor);
+    }
+}
+
+/// Execution space used by a permuted copy when none is given: the default execution space if it
+/// can access the memory of `dst`, the default host execution space otherwise
+template <class ChunkDst>
+using permuted_copy_execution_space_t = std::conditional_t<
+        Kokkos::SpaceAccessibility<
+                Kokkos::DefaultExecutionSpace,
+                typename std::remove_reference_t<ChunkDst>::memory_space>::accessible,
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultHostExecutionSpace>;
+
+template <class ExecSpace, class ChunkDst, class ChunkSrc>
+void permuted_deepcopy(ExecSpace const& execution_space, ChunkDst& dst, ChunkSrc const& src)
+{
+    static_assert(
+            type_seq_same_v<
+                    to_type_seq_t<typename ChunkDst::mdomain_type>,
+                    to_type_seq_t<typename ChunkSrc::mdomain_type>>,
+            "The domains of the chunks must hold the same dimensions");
+    static_assert(
+            Kokkos::SpaceAccessibility<ExecSpace, typename ChunkDst::memory_space>::accessible
+                    && Kokkos::SpaceAccessibility<ExecSpace, typename ChunkSrc::memory_space>::
+                            accessible,
+            "A permuted copy needs an execution space that can access both chunks");
+    permuted_deepcopy(
+            execution_space,
+            dst.allocation_mdspan(),
+            dst.domain(),
+            src.allocation_mdspan(),
+            src.domain());
+}
+
+/** Copies a chunk element by element, converting the values on assignment.
+ * It also copies between layouts that Kokkos views cannot describe.
+ */
+template <class SpanDst, class SpanSrc, class Shift>
+class ConvertingCopyFunctor
+{
+    SpanDst m_dst;
+
+    SpanSrc m_src;
+
+    /// Offset from an element of the destination to the matching element of the source
+    Shift m_shift;
+
+public:
+    ConvertingCopyFunctor(SpanDst const& dst, SpanSrc const& src, Shift const& shift)
+        : m_dst(dst)
+        , m_src(src)
+        , m_shift(shift)
+    {
+    }
+
+    template <class DElem>
+    KOKKOS_FUNCTION void operator()(DElem const& ielem) const
+    {
+        m_dst(ielem) = m_src(ielem + m_shift);
+    }
+};
+
+template <class ExecSpace, class ChunkDst, class ChunkSrc>
+void elementwise_deepcopy(ExecSpace const& execution_space, ChunkDst& dst, ChunkSrc const& src)
+{
+    static_assert(
+            Kokkos::SpaceAccessibility<ExecSpace, typename ChunkDst::memory_space>::accessible
+                    && Kokkos::SpaceAccessibility<ExecSpace, typename ChunkSrc::memory_space>::
+                            accessible,
+            "An element-wise copy, between different value types or layouts without Kokkos "
+            "counterpart, needs an execution space that can access both chunks");
+    auto const dst_span = dst.span_view();
+    auto const src_span = src.span_cview();
+    auto const shift = src.domain().front() - dst.domain().front();
+    parallel_for_each(
+            "ddc_elementwise_deepcopy",
+            execution_space,
+            dst.domain(),
+            ConvertingCopyFunctor<
+                    decltype(dst_span),
+                    decltype(src_span),
+                    decltype(shift)>(dst_span, src_span, shift));
+}
+
+} // namespace detail
+
 /** Copy the content of a borrowed chunk into another
+ *
+ * The domains of `dst` and `src` may list the same dimensions in a different order, the copy is
+ * then performed by a kernel running on an execution space that can access both chunks. So are
+ * the copies between different value types and between layouts without a Kokkos counterpart.
+ *
  * @param[out] dst the borrowed chunk in which to copy
  * @param[in]  src the borrowed chunk from which to copy
  * @return dst as a ChunkSpan
@@ -26,7 +229,23 @@ auto parallel_deepcopy(ChunkDst&& dst, ChunkSrc&& src)
             std::is_assignable_v<chunk_reference_t<ChunkDst>, chunk_reference_t<ChunkSrc>>,
             "Not assignable");
     assert(dst.domain().extents() == src.domain().extents());
-    Kokkos::deep_copy(dst.allocation_kokkos_view(), src.allocation_kokkos_view());
+    if constexpr (detail::is_permuted_copy_v<ChunkDst, ChunkSrc>) {
+        detail::permuted_copy_execution_space_t<ChunkDst> const execution_space;
+        detail::permuted_deepcopy(execution_space, dst, src);
+        execution_space.fence();
+    } else if constexpr (detail::is_converting_copy_v<ChunkDst, ChunkSrc>) {
+        detail::permuted_copy_execution_space_t<ChunkDst> const execution_space;
+        detail::elementwise_deepcopy(execution_space, dst, src);
+        execution_space.fence();
+    } else if constexpr (detail::is_flat_copyable_v<ChunkDst, ChunkSrc>) {
+        Kokkos::deep_copy(detail::flat_kokkos_view(dst), detail::flat_kokkos_view(src));
+    } else if constexpr (detail::is_kokkos_copyable_v<ChunkDst, ChunkSrc>) {
+        Kokkos::deep_copy(dst.allocation_kokkos_view(), src.allocation_kokkos_view());
+    } else {
+        detail::permuted_copy_execution_space_t<ChunkDst> const execution_space;
+        detail::elementwise_deepcopy(execution_space, dst, src);
+        execution_space.fence();
+    }
     return dst.span_view();
 }
 
@@ -45,7 +264,23 @@ auto parallel_deepcopy(ExecSpace const& execution_space, ChunkDst&& dst, ChunkSr
             std::is_assignable_v<chunk_reference_t<ChunkDst>, chunk_reference_t<ChunkSrc>>,
             "Not assignable");
     assert(dst.domain().extents() == src.domain().extents());
-    Kokkos::deep_copy(execution_space, dst.allocation_kokkos_view(), src.allocation_kokkos_view());
+    if constexpr (detail::is_permuted_copy_v<ChunkDst, ChunkSrc>) {
+        detail::permuted_deepcopy(execution_space, dst, src);
+    } else if constexpr (detail::is_converting_copy_v<ChunkDst, ChunkSrc>) {
+        detail::elementwise_deepcopy(execution_space, dst, src);
+    } else if constexpr (detail::is_flat_copyable_v<ChunkDst, ChunkSrc>) {
+        Kokkos::deep_copy(
+                execution_space,
+                detail::flat_kokkos_view(dst),
+                detail::flat_kokkos_view(src));
+    } else if constexpr (detail::is_kokkos_copyable_v<ChunkDst, ChunkSrc>) {
+        Kokkos::deep_copy(
+                execution_space,
+                dst.allocation_kokkos_view(),
+                src.allocation_kokkos_view());
+    } else {
+        detail::elementwise_deepcopy(execution_space, dst, src);
+    }
     return dst.span_view();
 }
 
@@ -9,9 +9,44 @@
 #include <Kokkos_Core.hpp>
 
 #include "ddc/chunk_traits.hpp"
+#include "ddc/detail/kokkos.hpp"
+#include "ddc/parallel_for_each.hpp"
 
 namespace ddc {
 
+namespace detail {
+
+/// Fills a chunk element by element, for the layouts without a Kokkos counterpart
+template <class Span, class T>
+class FillKokkosFunctor
+{
+    Span m_span;
+
+    T m_value;
+
+public:
+    FillKokkosFunctor(Span const& span, T const& value) : m_span(span), m_value(value) {}
+
+    template <class DElem>
+    KOKKOS_FUNCTION void operator()(DElem const& ielem) const
+    {
+        m_span(ielem) = m_value;
+    }
+};
+
+template <class ExecSpace, class ChunkDst, class T>
+void elementwise_fill(ExecSpace const& execution_space, ChunkDst& dst, T const& value)
+{
+    auto const span = dst.span_view();
+    parallel_for_each(
+            "ddc_parallel_fill",
+            execution_space,
+            dst.domain(),
+            FillKokkosFunctor<decltype(span), T>(span, value));
+}
+
+} // namespace detail
+
 /** Fill a borrowed chunk with a given value
  * @param[out] dst the borrowed chunk in which to copy
  * @param[in]  value the value to fill `dst`
@@ -22,7 +57,19 @@ auto parallel_fill(ChunkDst&& dst, T const& value)
 {
     static_assert(is_borrowed_chunk_v<ChunkDst>);
     static_assert(std::is_assignable_v<chunk_reference_t<ChunkDst>, T>, "Not assignable");
-    Kokkos::deep_copy(dst.allocation_kokkos_view(), value);
+    if constexpr (detail::has_kokkos_layout_v<
+                          typename std::remove_reference_t<ChunkDst>::layout_type>) {
+        Kokkos::deep_copy(dst.allocation_kokkos_view(), value);
+    } else {
+        std::conditional_t<
+                Kokkos::SpaceAccessibility<
+                        Kokkos::DefaultExecutionSpace,
+                        typename std::remove_reference_t<ChunkDst>::memory_space>::accessible,
+                Kokkos::DefaultExecutionSpace,
+                Kokkos::DefaultHostExecutionSpace> const execution_space;
+        detail::elementwise_fill(execution_space, dst, value);
+        execution_space.fence();
+    }
     return dst.span_view();
 }
 
@@ -37,7 +84,12 @@ auto parallel_fill(ExecSpace const& execution_space, ChunkDst&& dst, T const& va
 {
     static_assert(is_borrowed_chunk_v<ChunkDst>);
     static_assert(std::is_assignable_v<chunk_reference_t<ChunkDst>, T>, "Not assignable");
-    Kokkos::deep_copy(execution_space, dst.allocation_kokkos_view(), value);
+    if constexpr (detail::has_kokkos_layout_v<
+                          typename std::remove_reference_t<ChunkDst>::layout_type>) {
+        Kokkos::deep_copy(execution_space, dst.allocation_kokkos_view(), value);
+    } else {
+        detail::elementwise_fill(execution_space, dst, value);
+    }
     return dst.span_view();
 }
 
@@ -26,7 +26,7 @@ template <class F, class... DDims>
 class ForEachKokkosLambdaAdapter
 {
     template <class T>
-    using index_type = std::size_t;
+    using index_type = DiscreteElementType;
 
     F m_f;
 
@@ -70,12 +70,17 @@ void for_each_kokkos(
     if constexpr (need_annotated_operator<ExecSpace>()) {
         Kokkos::parallel_for(
                 label,
-                Kokkos::RangePolicy<ExecSpace, use_annotated_operator>(execution_space, 0, 1),
+                Kokkos::RangePolicy<
+                        ExecSpace,
+                        Kokkos::IndexType<DiscreteElementType>,
+                        use_annotated_operator>(execution_space, 0, 1),
                 ForEachKokkosLambdaAdapter<Functor>(f));
     } else {
         Kokkos::parallel_for(
                 label,
-                Kokkos::RangePolicy<ExecSpace>(execution_space, 0, 1),
+                Kokkos::RangePolicy<
+                        ExecSpace,
+                        Kokkos::IndexType<DiscreteElementType>>(execution_space, 0, 1),
                 ForEachKokkosLambdaAdapter<Functor>(f));
     }
 }
@@ -89,17 +94,22 @@ void for_each_kokkos(
 {
     DiscreteElement<DDim0> const ddc_begin = domain.front();
     DiscreteElement<DDim0> const ddc_end = domain.front() + domain.extents();
-    std::size_t const begin = ddc::uid<DDim0>(ddc_begin);
-    std::size_t const end = ddc::uid<DDim0>(ddc_end);
+    DiscreteElementType const begin = ddc::uid<DDim0>(ddc_begin);
+    DiscreteElementType const end = ddc::uid<DDim0>(ddc_end);
     if constexpr (need_annotated_operator<ExecSpace>()) {
         Kokkos::parallel_for(
                 label,
-                Kokkos::RangePolicy<ExecSpace, use_annotated_operator>(execution_space, begin, end),
+                Kokkos::RangePolicy<
+                        ExecSpace,
+                        Kokkos::IndexType<DiscreteElementType>,
+                        use_annotated_operator>(execution_space, begin, end),
                 ForEachKokkosLambdaAdapter<Functor, DDim0>(f));
     } else {
         Kokkos::parallel_for(
                 label,
-                Kokkos::RangePolicy<ExecSpace>(execution_space, begin, end),
+                Kokkos::RangePolicy<
+                        ExecSpace,
+                        Kokkos::IndexType<DiscreteElementType>>(execution_space, begin, end),
                 ForEachKokkosLambdaAdapter<Functor, DDim0>(f));
     }
 }
@@ -113,11 +123,11 @@ void for_each_kokkos(
 {
     DiscreteElement<DDim0, DDim1, DDims...> const ddc_begin = domain.front();
     DiscreteElement<DDim0, DDim1, DDims...> const ddc_end = domain.front() + domain.extents();
-    Kokkos::Array<std::size_t, 2 + sizeof...(DDims)> const
+    Kokkos::Array<DiscreteElementType, 2 + sizeof...(DDims)> const
             begin {ddc::uid<DDim0>(ddc_begin),
                    ddc::uid<DDim1>(ddc_begin),
                    ddc::uid<DDims>(ddc_begin)...};
-    Kokkos::Array<std::size_t, 2 + sizeof...(DDims)> const
+    Kokkos::Array<DiscreteElementType, 2 + sizeof...(DDims)> const
             end {ddc::uid<DDim0>(ddc_end), ddc::uid<DDim1>(ddc_end), ddc::uid<DDims>(ddc_end)...};
     if constexpr (need_annotated_operator<ExecSpace>()) {
         Kokkos::parallel_for(
@@ -128,6 +138,7 @@ void for_each_kokkos(
                                 2 + sizeof...(DDims),
                                 Kokkos::Iterate::Right,
                                 Kokkos::Iterate::Right>,
+                        Kokkos::IndexType<DiscreteElementType>,
                         use_annotated_operator>(execution_space, begin, end),
                 ForEachKokkosLambdaAdapter<Functor, DDim0, DDim1, DDims...>(f));
     } else {
@@ -138,7 +149,8 @@ void for_each_kokkos(
                         Kokkos::Rank<
                                 2 + sizeof...(DDims),
                                 Kokkos::Iterate::Right,
-                                Kokkos::Iterate::Right>>(execution_space, begin, end),
+                                Kokkos::Iterate::Right>,
+                        Kokkos::IndexType<DiscreteElementType>>(execution_space, begin, end),
                 ForEachKokkosLambdaAdapter<Functor, DDim0, DDim1, DDims...>(f));
     }
 }
@@ -0,0 +1,465 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc/chunk_traits.hpp"
+#include "ddc/detail/kokkos.hpp"
+#include "ddc/detail/type_seq.hpp"
+#include "ddc/discrete_domain.hpp"
+#include "ddc/discrete_element.hpp"
+#include "ddc/discrete_vector.hpp"
+
+namespace ddc {
+
+/** Read-only access to the neighbours of a point, staged in team scratch memory by
+ * `parallel_stencil`.
+ *
+ * Offsets are given as `DiscreteVector`s relative to the point being computed, dimensions absent
+ * from the offset are taken at the point itself. Offsets must stay within the stencil radius.
+ */
+template <class ElementType, class... DDims>
+class StencilAccessor
+{
+    static constexpr std::size_t s_rank = sizeof...(DDims);
+
+    ElementType const* m_data;
+
+    Kokkos::Array<std::ptrdiff_t, s_rank> m_strides;
+
+    std::ptrdiff_t m_center;
+
+public:
+    KOKKOS_FUNCTION StencilAccessor(
+            ElementType const* const data,
+            Kokkos::Array<std::ptrdiff_t, s_rank> const& strides,
+            std::ptrdiff_t const center) noexcept
+        : m_data(data)
+        , m_strides(strides)
+        , m_center(center)
+    {
+    }
+
+    /// Value at the point being computed
+    KOKKOS_FUNCTION ElementType const& operator()() const noexcept
+    {
+        return m_data[m_center];
+    }
+
+    /// Value at the point shifted by `offset`
+    template <class... ODDims>
+    KOKKOS_FUNCTION ElementType const& operator()(
+            DiscreteVector<ODDims...> const& offset) const noexcept
+    {
+        static_assert(
+                (in_tags_v<ODDims, detail::TypeSeq<DDims...>> && ...),
+                "Unknown dimension in the stencil offset");
+        std::ptrdiff_t const shift
+                = (0 + ...
+                   + (offset.template get<ODDims>()
+                      * m_strides[type_seq_rank_v<ODDims, detail::TypeSeq<DDims...>>]));
+        return m_data[m_center + shift];
+    }
+};
+
+namespace detail {
+
+/// Extent of the tiles of `parallel_stencil` in dimension `r` of a rank `n` domain: the innermost
+/// dimensions get the largest extents to keep contiguous accesses to the global memory
+constexpr std::size_t stencil_tile_extent(std::size_t const n, std::size_t const r) noexcept
+{
+    std::size_t const depth = n - 1 - r;
+    return depth == 0 ? 32 : depth == 1 ? 8 : depth == 2 ? 4 : 1;
+}
+
+/// Number of tiles of `parallel_stencil` in each dimension of `domain`
+template <class... DDims>
+Kokkos::Array<std::size_t, sizeof...(DDims)> stencil_nb_tiles(
+        DiscreteDomain<DDims...> const& domain) noexcept
+{
+    constexpr std::size_t n = sizeof...(DDims);
+    return {(static_cast<std::size_t>(domain.template extent<DDims>().value())
+             + stencil_tile_extent(n, type_seq_rank_v<DDims, TypeSeq<DDims...>>) - 1)
+            / stencil_tile_extent(n, type_seq_rank_v<DDims, TypeSeq<DDims...>>)...};
+}
+
+/// Number of elements of the largest tile of `parallel_stencil` extended by `nb_steps` times
+/// `radius`
+template <class... DDims>
+std::size_t stencil_scratch_extent(
+        DiscreteDomain<DDims...> const& domain,
+        DiscreteVector<DDims...> const& radius,
+        std::size_t const nb_steps = 1) noexcept
+{
+    constexpr std::size_t n = sizeof...(DDims);
+    return ((std::min(
+                     stencil_tile_extent(n, type_seq_rank_v<DDims, TypeSeq<DDims...>>),
+                     static_cast<std::size_t>(domain.template extent<DDims>().value()))
+             + 2 * nb_steps * static_cast<std::size_t>(radius.template get<DDims>()))
+            * ... * 1);
+}
+
+template <class ExecSpace, class ChunkIn, class ChunkOut, class F, class... DDims>
+class StencilKokkosFunctor
+{
+    static constexpr std::size_t s_rank = sizeof...(DDims);
+
+    using element_type = chunk_value_t<ChunkIn>;
+
+    using member_type = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+
+    using scratch_view_type = Kokkos::View<
+            element_type*,
+            typename ExecSpace::scratch_memory_space,
+            Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    ChunkIn m_in;
+
+    ChunkOut m_out;
+
+    F m_f;
+
+    DiscreteElement<DDims...> m_front;
+
+    Kokkos::Array<std::size_t, s_rank> m_extents;
+
+    Kokkos::Array<std::size_t, s_rank> m_radius;
+
+    Kokkos::Array<std::size_t, s_rank> m_nb_tiles;
+
+    std::size_t m_nb_steps;
+
+    int m_scratch_level;
+
+    /// Element at `local` in the box starting at `origin`, shifted back by `shift`
+    KOKKOS_FUNCTION DiscreteElement<DDims...> element(
+            Kokkos::Array<std::size_t, s_rank> const& origin,
+            Kokkos::Array<std::size_t, s_rank> const& local,
+            Kokkos::Array<std::size_t, s_rank> const& shift) const
+    {
+        return DiscreteElement<DDims...>(
+                (uid<DDims>(m_front) + origin[type_seq_rank_v<DDims, TypeSeq<DDims...>>]
+                 + local[type_seq_rank_v<DDims, TypeSeq<DDims...>>]
+                 - shift[type_seq_rank_v<DDims, TypeSeq<DDims...>>])...);
+    }
+
+    KOKKOS_FUNCTION void apply(member_type const& team) const
+    {
+        // Position and extents of the tile handled by this team, with and without its halo
+        Kokkos::Array<std::size_t, s_rank> origin;
+        Kokkos::Array<std::size_t, s_rank> tile;
+        Kokkos::Array<std::size_t, s_rank> halo;
+        Kokkos::Array<std::size_t, s_rank> halo_tile;
+        Kokkos::Array<std::ptrdiff_t, s_rank> strides;
+        std::size_t tile_id = team.league_rank();
+        std::size_t halo_tile_size = 1;
+        for (std::size_t r = s_rank; r > 0; --r) {
+            std::size_t const d = r - 1;
+            std::size_t const tile_extent = stencil_tile_extent(s_rank, d);
+            origin[d] = (tile_id % m_nb_tiles[d]) * tile_extent;
+            tile_id /= m_nb_tiles[d];
+            tile[d] = Kokkos::min(tile_extent, m_extents[d] - origin[d]);
+            halo[d] = m_nb_steps * m_radius[d];
+            halo_tile[d] = tile[d] + 2 * halo[d];
+            strides[d] = static_cast<std::ptrdiff_t>(halo_tile_size);
+            halo_tile_size *= halo_tile[d];
+        }
+
+        // Stage the tile and its halo in scratch memory, a second buffer of the same size holds
+        // the intermediate steps
+        std::size_t const nb_buffers = m_nb_steps > 1 ? 2 : 1;
+        scratch_view_type const
+                scratch(team.team_scratch(m_scratch_level), nb_buffers * halo_tile_size);
+        Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team, halo_tile_size),
+                [&](std::size_t const k) {
+                    Kokkos::Array<std::size_t, s_rank> local;
+                    std::size_t rest = k;
+                    for (std::size_t r = s_rank; r > 0; --r) {
+                        local[r - 1] = rest % halo_tile[r - 1];
+                        rest /= halo_tile[r - 1];
+                    }
+                    scratch(k) = m_in(element(origin, local, halo));
+                });
+        team.team_barrier();
+
+        // Each step computes the region of the previous one shrunk by the radius, the last one
+        // being the tile itself
+        element_type* src = scratch.data();
+        element_type* dst = scratch.data() + (nb_buffers - 1) * halo_tile_size;
+        for (std::size_t step = 1; step <= m_nb_steps; ++step) {
+            bool const is_last_step = step == m_nb_steps;
+            Kokkos::Array<std::size_t, s_rank> margin;
+            Kokkos::Array<std::size_t, s_rank> region;
+            std::size_t region_size = 1;
+            for (std::size_t d = 0; d < s_rank; ++d) {
+                margin[d] = (m_nb_steps - step) * m_radius[d];
+                region[d] = tile[d] + 2 * margin[d];
+                region_size *= region[d];
+            }
+            Kokkos::parallel_for(
+                    Kokkos::TeamThreadRange(team, region_size),
+                    [&](std::size_t const k) {
+                        Kokkos::Array<std::size_t, s_rank> local;
+                        std::ptrdiff_t center = 0;
+                        std::size_t rest = k;
+                        for (std::size_t r = s_rank; r > 0; --r) {
+                            local[r - 1] = rest % region[r - 1];
+                            rest /= region[r - 1];
+                            center += static_cast<std::ptrdiff_t>(
+                                              local[r - 1] + halo[r - 1] - margin[r - 1])
+                                      * strides[r - 1];
+                        }
+                        DiscreteElement<DDims...> const ielem = element(origin, local, margin);
+                        StencilAccessor<element_type, DDims...> const
+                                neighbours(src, strides, center);
+                        if (is_last_step) {
+                            m_out(ielem) = m_f(ielem, neighbours);
+                        } else {
+                            dst[center] = m_f(ielem, neighbours);
+                        }
+                    });
+            if (!is_last_step) {
+                team.team_barrier();
+                element_type* const tmp = src;
+                src = dst;
+                dst = tmp;
+            }
+        }
+    }
+
+public:
+    StencilKokkosFunctor(
+            ChunkIn const& in,
+            ChunkOut const& out,
+            F const& f,
+            DiscreteDomain<DDims...> const& domain,
+            DiscreteVector<DDims...> const& radius,
+            std::size_t const nb_steps,
+            int const scratch_level)
+        : m_in(in)
+        , m_out(out)
+        , m_f(f)
+        , m_front(domain.front())
+        , m_extents {static_cast<std::size_t>(domain.template extent<DDims>().value())...}
+        , m_radius {static_cast<std::size_t>(radius.template get<DDims>())...}
+        , m_nb_tiles(stencil_nb_tiles(domain))
+        , m_nb_steps(nb_steps)
+        , m_scratch_level(scratch_level)
+    {
+    }
+
+    void operator()(member_type const& team) const
+    {
+        apply(team);
+    }
+
+    KOKKOS_FUNCTION void operator()(use_annotated_operator, member_type const& team) const
+    {
+        apply(team);
+    }
+};
+
+template <class ExecSpace, class... DDims, class ChunkIn, class ChunkOut, class Functor>
+void launch_stencil(
+        std::string const& label,
+        ExecSpace const& execution_space,
+        DiscreteDomain<DDims...> const& domain,
+        DiscreteVector<DDims...> const& radius,
+        std::size_t const nb_steps,
+        ChunkIn&& in,
+        ChunkOut&& out,
+        Functor const& f)
+{
+    static_assert(sizeof...(DDims) > 0, "Expected at least one dimension");
+    static_assert(is_borrowed_chunk_v<ChunkIn>);
+    static_assert(is_borrowed_chunk_v<ChunkOut>);
+    assert(nb_steps > 0);
+    assert(((radius.template get<DDims>() >= 0) && ...));
+    [[maybe_unused]] std::ptrdiff_t const depth = static_cast<std::ptrdiff_t>(nb_steps);
+    assert(((front<DDims>(in.domain()) + depth * radius.template get<DDims>()
+             <= front<DDims>(domain))
+            && ...));
+    assert(((back<DDims>(domain) + depth * radius.template get<DDims>()
+             <= back<DDims>(in.domain()))
+            && ...));
+    if (domain.empty()) {
+        return;
+    }
+    auto const in_view = in.span_cview();
+    auto const out_span = out.span_view();
+    using policy_type = std::conditional_t<
+            need_annotated_operator<ExecSpace>(),
+            Kokkos::TeamPolicy<ExecSpace, use_annotated_operator>,
+            Kokkos::TeamPolicy<ExecSpace>>;
+    using scratch_view_type = Kokkos::View<
+            chunk_value_t<ChunkIn>*,
+            typename ExecSpace::scratch_memory_space,
+            Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+    std::size_t const nb_buffers = nb_steps > 1 ? 2 : 1;
+    std::size_t const scratch_size = scratch_view_type::shmem_size(
+            nb_buffers * stencil_scratch_extent(domain, radius, nb_steps));
+    // Tiles that do not fit in the fast team scratch memory are staged in the slower level
+    int const scratch_level
+            = scratch_size <= static_cast<std::size_t>(policy_type::scratch_size_max(0)) ? 0 : 1;
+    Kokkos::Array<std::size_t, sizeof...(DDims)> const nb_tiles = stencil_nb_tiles(domain);
+    std::size_t league_size = 1;
+    for (std::size_t r = 0; r < sizeof...(DDims); ++r) {
+        league_size *= nb_tiles[r];
+    }
+    StencilKokkosFunctor<
+            ExecSpace,
+            decltype(in_view),
+            decltype(out_span),
+            Functor,
+            DDims...> const
+            functor(in_view, out_span, f, domain, radius, nb_steps, scratch_level);
+    policy_type policy(execution_space, league_size, Kokkos::AUTO);
+    policy.set_scratch_size(scratch_level, Kokkos::PerTeam(scratch_size));
+    Kokkos::parallel_for(label, policy, functor);
+}
+
+} // namespace detail
+
+/** Applies a stencil over a nD domain using a given `Kokkos` execution space.
+ *
+ * The domain is split into tiles, each handled by a team that first copies the tile and its halo
+ * from `in` into team scratch memory. For every element `ielem` of the tile, the functor is then
+ * called as `f(ielem, neighbours)` where `neighbours` is a `StencilAccessor` reading the staged
+ * values, and its result is stored in `out(ielem)`.
+ *
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] domain the domain over which to compute `out`
+ * @param[in] radius the extent of the stencil on each side of a point, in each dimension
+ * @param[in] in a borrowed chunk defined at least on `domain` extended by `radius`
+ * @param[out] out a borrowed chunk defined at least on `domain`
+ * @param[in] f a functor taking an element and a `StencilAccessor` as parameters
+ */
+template <class ExecSpace, class... DDims, class ChunkIn, class ChunkOut, class Functor>
+void parallel_stencil(
+        ExecSpace const& execution_space,
+        DiscreteDomain<DDims...> const& domain,
+        DiscreteVector<DDims...> const& radius,
+        ChunkIn&& in,
+        ChunkOut&& out,
+        Functor const& f)
+{
+    detail::launch_stencil(
+            "ddc_parallel_stencil",
+            execution_space,
+            domain,
+            radius,
+            1,
+            std::forward<ChunkIn>(in),
+            std::forward<ChunkOut>(out),
+            f);
+}
+
+/** Applies a stencil over a nD domain using the `Kokkos` default execution space.
+ * @param[in] domain the domain over which to compute `out`
+ * @param[in] radius the extent of the stencil on each side of a point, in each dimension
+ * @param[in] in a borrowed chunk defined at least on `domain` extended by `radius`
+ * @param[out] out a borrowed chunk defined at least on `domain`
+ * @param[in] f a functor taking an element and a `StencilAccessor` as parameters
+ */
+template <class... DDims, class ChunkIn, class ChunkOut, class Functor>
+void parallel_stencil(
+        DiscreteDomain<DDims...> const& domain,
+        DiscreteVector<DDims...> const& radius,
+        ChunkIn&& in,
+        ChunkOut&& out,
+        Functor const& f)
+{
+    parallel_stencil(
+            Kokkos::DefaultExecutionSpace(),
+            domain,
+            radius,
+            std::forward<ChunkIn>(in),
+            std::forward<ChunkOut>(out),
+            f);
+}
+
+
+/** Applies `nb_steps` times a stencil over a nD domain using a given `Kokkos` execution space.
+ *
+ * The time loop is tiled: each team stages its tile extended by `nb_steps` times the radius in
+ * scratch memory, then applies the stencil `nb_steps` times on regions shrinking by the radius at
+ * each step, so that only the last step is written to `out`. The points near the edges of a tile
+ * are computed redundantly by the neighbouring teams, in exchange `in` and `out` are only
+ * accessed once for `nb_steps` steps. The functor is thus also called on the elements of the
+ * first `nb_steps - 1` layers of radius around `domain` and must be defined there.
+ *
+ * Calling this function with `nb_steps` equal to one is equivalent to calling `parallel_stencil`.
+ * The ghost points of `in` are typically filled beforehand by a `HaloExchange` whose ghosted
+ * domain is `domain` extended by `nb_steps` times the radius.
+ *
+ * @param[in] execution_space a Kokkos execution space where the loop will be executed on
+ * @param[in] domain the domain over which to compute `out`
+ * @param[in] radius the extent of the stencil on each side of a point, in each dimension
+ * @param[in] nb_steps the number of times the stencil is applied, at least one
+ * @param[in] in a borrowed chunk defined at least on `domain` extended by `nb_steps` times
+ *            `radius`
+ * @param[out] out a borrowed chunk defined at least on `domain`
+ * @param[in] f a functor taking an element and a `StencilAccessor` as parameters
+ */
+template <class ExecSpace, class... DDims, class ChunkIn, class ChunkOut, class Functor>
+void parallel_stencil_steps(
+        ExecSpace const& execution_space,
+        DiscreteDomain<DDims...> const& domain,
+        DiscreteVector<DDims...> const& radius,
+        std::size_t const nb_steps,
+        ChunkIn&& in,
+        ChunkOut&& out,
+        Functor const& f)
+{
+    detail::launch_stencil(
+            "ddc_parallel_stencil_steps",
+            execution_space,
+            domain,
+            radius,
+            nb_steps,
+            std::forward<ChunkIn>(in),
+            std::forward<ChunkOut>(out),
+            f);
+}
+
+/** Applies `nb_steps` times a stencil over a nD domain using the `Kokkos` default execution
+ * space.
+ * @param[in] domain the domain over which to compute `out`
+ * @param[in] radius the extent of the stencil on each side of a point, in each dimension
+ * @param[in] nb_steps the number of times the stencil is applied, at least one
+ * @param[in] in a borrowed chunk defined at least on `domain` extended by `nb_steps` times
+ *            `radius`
+ * @param[out] out a borrowed chunk defined at least on `domain`
+ * @param[in] f a functor taking an element and a `StencilAccessor` as parameters
+ */
+template <class... DDims, class ChunkIn, class ChunkOut, class Functor>
+void parallel_stencil_steps(
+        DiscreteDomain<DDims...> const& domain,
+        DiscreteVector<DDims...> const& radius,
+        std::size_t const nb_steps,
+        ChunkIn&& in,
+        ChunkOut&& out,
+        Functor const& f)
+{
+    parallel_stencil_steps(
+            Kokkos::DefaultExecutionSpace(),
+            domain,
+            radius,
+            nb_steps,
+            std::forward<ChunkIn>(in),
+            std::forward<ChunkOut>(out),
+            f);
+}
+
+} // namespace ddc
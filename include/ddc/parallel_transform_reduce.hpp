@@ -92,7 +92,7 @@ template <class Reducer, class Functor, class... DDims>
 class TransformReducerKokkosLambdaAdapter
 {
     template <class T>
-    using index_type = std::size_t;
+    using index_type = DiscreteElementType;
 
     Reducer reducer;
 
@@ -160,7 +160,10 @@ T transform_reduce_kokkos(
     if constexpr (need_annotated_operator<ExecSpace>()) {
         Kokkos::parallel_reduce(
                 label,
-                Kokkos::RangePolicy<ExecSpace, use_annotated_operator>(execution_space, 0, 1),
+                Kokkos::RangePolicy<
+                        ExecSpace,
+                        Kokkos::IndexType<DiscreteElementType>,
+                        use_annotated_operator>(execution_space, 0, 1),
                 TransformReducerKokkosLambdaAdapter<
                         BinaryReductionOp,
                         UnaryTransformOp>(reduce, transform),
@@ -168,7 +171,9 @@ T transform_reduce_kokkos(
     } else {
         Kokkos::parallel_reduce(
                 label,
-                Kokkos::RangePolicy<ExecSpace>(execution_space, 0, 1),
+                Kokkos::RangePolicy<
+                        ExecSpace,
+                        Kokkos::IndexType<DiscreteElementType>>(execution_space, 0, 1),
                 TransformReducerKokkosLambdaAdapter<
                         BinaryReductionOp,
                         UnaryTransformOp>(reduce, transform),
@@ -200,7 +205,10 @@ T transform_reduce_kokkos(
     if constexpr (need_annotated_operator<ExecSpace>()) {
         Kokkos::parallel_reduce(
                 label,
-                Kokkos::RangePolicy<ExecSpace, use_annotated_operator>(
+                Kokkos::RangePolicy<
+                        ExecSpace,
+                        Kokkos::IndexType<DiscreteElementType>,
+                        use_annotated_operator>(
                         execution_space,
                         domain.front().uid(),
                         domain.back().uid() + 1),
@@ -213,7 +221,11 @@ T transform_reduce_kokkos(
         Kokkos::parallel_reduce(
                 label,
                 Kokkos::RangePolicy<
-                        ExecSpace>(execution_space, domain.front().uid(), domain.back().uid() + 1),
+                        ExecSpace,
+                        Kokkos::IndexType<DiscreteElementType>>(
+                        execution_space,
+                        domain.front().uid(),
+                        domain.back().uid() + 1),
                 TransformReducerKokkosLambdaAdapter<
                         BinaryReductionOp,
                         UnaryTransformOp,
@@ -250,11 +262,11 @@ T transform_reduce_kokkos(
         UnaryTransformOp const& transform) noexcept
 {
     T result = neutral;
-    Kokkos::Array<std::size_t, 2 + sizeof...(DDims)> const
+    Kokkos::Array<DiscreteElementType, 2 + sizeof...(DDims)> const
             begin {select<DDim0>(domain).front().uid(),
                    select<DDim1>(domain).front().uid(),
                    select<DDims>(domain).front().uid()...};
-    Kokkos::Array<std::size_t, 2 + sizeof...(DDims)> const
+    Kokkos::Array<DiscreteElementType, 2 + sizeof...(DDims)> const
             end {select<DDim0>(domain).back().uid() + 1,
                  select<DDim1>(domain).back().uid() + 1,
                  (select<DDims>(domain).back().uid() + 1)...};
@@ -264,6 +276,7 @@ T transform_reduce_kokkos(
                 Kokkos::MDRangePolicy<
                         ExecSpace,
                         Kokkos::Rank<2 + sizeof...(DDims)>,
+                        Kokkos::IndexType<DiscreteElementType>,
                         use_annotated_operator>(execution_space, begin, end),
                 TransformReducerKokkosLambdaAdapter<
                         BinaryReductionOp,
@@ -277,7 +290,8 @@ T transform_reduce_kokkos(
                 label,
                 Kokkos::MDRangePolicy<
                         ExecSpace,
-                        Kokkos::Rank<2 + sizeof...(DDims)>>(execution_space, begin, end),
+                        Kokkos::Rank<2 + sizeof...(DDims)>,
+                        Kokkos::IndexType<DiscreteElementType>>(execution_space, begin, end),
                 TransformReducerKokkosLambdaAdapter<
                         BinaryReductionOp,
                         UnaryTransformOp,
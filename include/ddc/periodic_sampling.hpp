@@ -131,6 +131,20 @@ public:
                              - static_cast<int>(m_n_period / 2))
                              * m_step;
         }
+
+        /** @brief Convert a position in `CDim` into the index of the cell containing it
+         *
+         * The cell `i` starts at `coordinate(i)` and has the length of a step, the position is
+         * first brought back into the period.
+         */
+        KOKKOS_FUNCTION discrete_element_type
+        find_cell(continuous_element_type const& x) const noexcept
+        {
+            Real const t = (x - m_origin) / m_step;
+            long const n_period = static_cast<long>(m_n_period);
+            long const k = static_cast<long>(Kokkos::floor(t)) % n_period;
+            return discrete_element_type(k < 0 ? k + n_period : k);
+        }
     };
 
     /** Construct a Impl<Kokkos::HostSpace> and associated discrete_domain_type from a segment
@@ -290,6 +304,14 @@ KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> coordinate(
     return discrete_space<DDim>().coordinate(c);
 }
 
+/// @brief Index of the cell containing `x` once brought back into the period
+template <class DDim, std::enable_if_t<is_periodic_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION DiscreteElement<DDim> find_cell(
+        Coordinate<typename DDim::continuous_dimension_type> const& x)
+{
+    return discrete_space<DDim>().find_cell(x);
+}
+
 template <class DDim, std::enable_if_t<is_periodic_sampling_v<DDim>, int> = 0>
 KOKKOS_FUNCTION Coordinate<typename DDim::continuous_dimension_type> distance_at_left(
         DiscreteElement<DDim>)
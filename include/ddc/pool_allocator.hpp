@@ -0,0 +1,285 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc/kokkos_allocator.hpp"
+
+namespace ddc {
+
+namespace detail {
+
+/// Rounds a number of bytes up to its size class.
+/// Each power of two is split into four classes so that at most 25% of a block is wasted.
+constexpr std::size_t pool_size_class(std::size_t const n) noexcept
+{
+    std::size_t constexpr min_size_class = 256;
+    if (n <= min_size_class) {
+        return min_size_class;
+    }
+    std::size_t p = min_size_class;
+    while (p <= n / 2) {
+        p *= 2;
+    }
+    std::size_t const step = p / 4;
+    return ((n + step - 1) / step) * step;
+}
+
+} // namespace detail
+
+/** A caching pool of memory blocks allocated in `MemorySpace`.
+ *
+ * Blocks are sorted into size classes, each with its own free list. A deallocated block goes
+ * back to the free list of its class and is handed out again by the next allocation of the same
+ * class, so a loop that repeatedly creates and destroys the same temporaries only performs
+ * system allocations during its first iteration.
+ *
+ * The pool must be destroyed (or reset) before `Kokkos::finalize` is called.
+ */
+template <class MemorySpace>
+class MemoryPool
+{
+    using block_allocator_type = KokkosAllocator<std::byte, MemorySpace>;
+
+    std::string m_label;
+
+    mutable std::mutex m_mutex;
+
+    /// Idle blocks sorted by size class
+    std::map<std::size_t, std::vector<std::byte*>> m_free_blocks;
+
+    std::size_t m_nb_system_allocations = 0;
+
+    std::size_t m_nb_allocations = 0;
+
+    std::size_t m_used_bytes = 0;
+
+    std::size_t m_cached_bytes = 0;
+
+public:
+    using memory_space = MemorySpace;
+
+    explicit MemoryPool(std::string label = "ddc_memory_pool") : m_label(std::move(label)) {}
+
+    MemoryPool(MemoryPool const& x) = delete;
+
+    MemoryPool(MemoryPool&& x) = delete;
+
+    ~MemoryPool()
+    {
+        reset();
+    }
+
+    MemoryPool& operator=(MemoryPool const& x) = delete;
+
+    MemoryPool& operator=(MemoryPool&& x) = delete;
+
+    /** Returns a block of at least `n` bytes, reusing an idle block of the same size class if any
+     * @param label the label given to the block if a system allocation is needed
+     * @param n the number of bytes
+     * @return a pointer to the block, nullptr if `n` is zero
+     */
+    [[nodiscard]] void* allocate(std::string const& label, std::size_t const n)
+    {
+        if (n == 0) {
+            return nullptr;
+        }
+        std::size_t const size_class = detail::pool_size_class(n);
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        ++m_nb_allocations;
+        m_used_bytes += size_class;
+        auto const it = m_free_blocks.find(size_class);
+        if (it != m_free_blocks.end() && !it->second.empty()) {
+            std::byte* const p = it->second.back();
+            it->second.pop_back();
+            m_cached_bytes -= size_class;
+            return p;
+        }
+        ++m_nb_system_allocations;
+        return block_allocator_type().allocate(m_label + ":" + label, size_class);
+    }
+
+    /** Gives a block back to the pool, the memory is kept for later allocations
+     * @param p the pointer returned by `allocate`
+     * @param n the number of bytes given to `allocate`
+     */
+    void deallocate(void* const p, std::size_t const n)
+    {
+        if (p == nullptr) {
+            return;
+        }
+        std::size_t const size_class = detail::pool_size_class(n);
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        m_used_bytes -= size_class;
+        m_cached_bytes += size_class;
+        m_free_blocks[size_class].push_back(static_cast<std::byte*>(p));
+    }
+
+    /** Returns all idle blocks to the memory space and resets the counters.
+     * Blocks currently in use are not affected and can still be deallocated afterwards.
+     */
+    void reset()
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        for (auto& [size_class, blocks] : m_free_blocks) {
+            for (std::byte* const p : blocks) {
+                block_allocator_type().deallocate(p, size_class);
+            }
+        }
+        m_free_blocks.clear();
+        m_cached_bytes = 0;
+        m_nb_system_allocations = 0;
+        m_nb_allocations = 0;
+    }
+
+    std::string const& label() const noexcept
+    {
+        return m_label;
+    }
+
+    /// Number of allocations that could not be served from the free lists since the last reset
+    std::size_t nb_system_allocations() const
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        return m_nb_system_allocations;
+    }
+
+    /// Number of allocations served since the last reset
+    std::size_t nb_allocations() const
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        return m_nb_allocations;
+    }
+
+    /// Number of bytes held by blocks currently in use
+    std::size_t used_bytes() const
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        return m_used_bytes;
+    }
+
+    /// Number of bytes held by idle blocks
+    std::size_t cached_bytes() const
+    {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        return m_cached_bytes;
+    }
+};
+
+/** An allocator drawing its memory from a shared `MemoryPool`.
+ *
+ * Copies of a `PoolAllocator` refer to the same pool. A default-constructed `PoolAllocator`
+ * is not attached to any pool and behaves like a `KokkosAllocator`.
+ */
+template <class T, class MemorySpace>
+class PoolAllocator
+{
+    template <class, class>
+    friend class PoolAllocator;
+
+    std::shared_ptr<MemoryPool<MemorySpace>> m_pool;
+
+public:
+    using value_type = T;
+
+    using memory_space = MemorySpace;
+
+    template <class U>
+    struct rebind
+    {
+        using other = PoolAllocator<U, MemorySpace>;
+    };
+
+    PoolAllocator() = default;
+
+    explicit PoolAllocator(std::shared_ptr<MemoryPool<MemorySpace>> pool) noexcept
+        : m_pool(std::move(pool))
+    {
+    }
+
+    PoolAllocator(PoolAllocator const& x) = default;
+
+    PoolAllocator(PoolAllocator&& x) noexcept = default;
+
+    template <class U>
+    explicit PoolAllocator(PoolAllocator<U, MemorySpace> const& x) noexcept : m_pool(x.m_pool)
+    {
+    }
+
+    ~PoolAllocator() = default;
+
+    PoolAllocator& operator=(PoolAllocator const& x) = default;
+
+    PoolAllocator& operator=(PoolAllocator&& x) noexcept = default;
+
+    template <class U>
+    PoolAllocator& operator=(PoolAllocator<U, MemorySpace> const& x) noexcept
+    {
+        m_pool = x.m_pool;
+        return *this;
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n) const
+    {
+        return allocate("no-label", n);
+    }
+
+    [[nodiscard]] T* allocate(std::string const& label, std::size_t n) const
+    {
+        if (!m_pool) {
+            return KokkosAllocator<T, MemorySpace>().allocate(label, n);
+        }
+        return static_cast<T*>(m_pool->allocate(label, sizeof(T) * n));
+    }
+
+    void deallocate(T* p, std::size_t n) const
+    {
+        if (!m_pool) {
+            KokkosAllocator<T, MemorySpace>().deallocate(p, n);
+            return;
+        }
+        m_pool->deallocate(p, sizeof(T) * n);
+    }
+
+    /// The pool this allocator draws from, nullptr if none
+    std::shared_ptr<MemoryPool<MemorySpace>> const& pool() const noexcept
+    {
+        return m_pool;
+    }
+};
+
+template <class T, class MST, class U, class MSU>
+bool operator==(PoolAllocator<T, MST> const& lhs, PoolAllocator<U, MSU> const& rhs) noexcept
+{
+    if constexpr (std::is_same_v<MST, MSU>) {
+        return lhs.pool() == rhs.pool();
+    } else {
+        return false;
+    }
+}
+
+template <class T, class MST, class U, class MSU>
+bool operator!=(PoolAllocator<T, MST> const& lhs, PoolAllocator<U, MSU> const& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+template <class T>
+using DevicePoolAllocator = PoolAllocator<T, Kokkos::DefaultExecutionSpace::memory_space>;
+
+template <class T>
+using HostPoolAllocator = PoolAllocator<T, Kokkos::HostSpace>;
+
+} // namespace ddc
@@ -0,0 +1,272 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include "ddc/kokkos_allocator.hpp"
+
+namespace ddc {
+
+/** A bump-pointer allocator over a single buffer allocated in `MemorySpace`.
+ *
+ * Allocations are served by incrementing an offset in the buffer. Memory is reclaimed by
+ * rewinding the offset, either explicitly with `rewind`/`reset` or with a `ScratchArena::Scope`
+ * that restores the offset it observed at construction. This fits temporaries that are strictly
+ * nested, the whole buffer being released in O(1).
+ */
+template <class MemorySpace>
+class ScratchArena
+{
+    using buffer_allocator_type = KokkosAllocator<std::byte, MemorySpace>;
+
+    std::byte* m_buffer = nullptr;
+
+    std::size_t m_capacity = 0;
+
+    std::size_t m_offset = 0;
+
+    std::size_t m_high_water_mark = 0;
+
+public:
+    using memory_space = MemorySpace;
+
+    /// Default alignment of allocations, in bytes
+    static constexpr std::size_t default_alignment = 64;
+
+    /** RAII marker restoring the arena offset at destruction
+     */
+    class Scope
+    {
+        ScratchArena* m_arena;
+
+        std::size_t m_marker;
+
+    public:
+        explicit Scope(ScratchArena& arena) noexcept : m_arena(&arena), m_marker(arena.marker())
+        {
+        }
+
+        Scope(Scope const& x) = delete;
+
+        Scope(Scope&& x) = delete;
+
+        ~Scope() noexcept
+        {
+            m_arena->rewind(m_marker);
+        }
+
+        Scope& operator=(Scope const& x) = delete;
+
+        Scope& operator=(Scope&& x) = delete;
+    };
+
+    /** Allocates the buffer of the arena
+     * @param label the label of the buffer
+     * @param capacity the size of the buffer in bytes
+     */
+    ScratchArena(std::string const& label, std::size_t const capacity)
+        : m_buffer(buffer_allocator_type().allocate(label, capacity))
+        , m_capacity(capacity)
+    {
+    }
+
+    explicit ScratchArena(std::size_t const capacity) : ScratchArena("ddc_scratch_arena", capacity)
+    {
+    }
+
+    ScratchArena(ScratchArena const& x) = delete;
+
+    ScratchArena(ScratchArena&& x) = delete;
+
+    ~ScratchArena()
+    {
+        if (m_buffer) {
+            buffer_allocator_type().deallocate(m_buffer, m_capacity);
+        }
+    }
+
+    ScratchArena& operator=(ScratchArena const& x) = delete;
+
+    ScratchArena& operator=(ScratchArena&& x) = delete;
+
+    /** Bumps the offset to allocate `n` bytes
+     * @param n the number of bytes
+     * @param alignment the alignment of the returned pointer, a power of two
+     * @return a pointer inside the buffer, nullptr if `n` is zero
+     */
+    [[nodiscard]] void* allocate(
+            std::size_t const n,
+            std::size_t const alignment = default_alignment)
+    {
+        if (n == 0) {
+            return nullptr;
+        }
+        std::uintptr_t const address = reinterpret_cast<std::uintptr_t>(m_buffer) + m_offset;
+        std::size_t const padding = (alignment - address % alignment) % alignment;
+        std::size_t const begin = m_offset + padding;
+        if (begin + n > m_capacity) {
+            throw std::runtime_error(
+                    "ScratchArena capacity exceeded: " + std::to_string(begin + n) + " > "
+                    + std::to_string(m_capacity) + " bytes");
+        }
+        m_offset = begin + n;
+        m_high_water_mark = std::max(m_high_water_mark, m_offset);
+        return m_buffer + begin;
+    }
+
+    /** Releases `n` bytes at `p` if they are the last allocation, does nothing otherwise
+     * @param p the pointer returned by `allocate`
+     * @param n the number of bytes given to `allocate`
+     */
+    void deallocate(void* const p, std::size_t const n) noexcept
+    {
+        if (p != nullptr && static_cast<std::byte*>(p) + n == m_buffer + m_offset) {
+            m_offset = static_cast<std::byte*>(p) - m_buffer;
+        }
+    }
+
+    /// Current offset, to be given later to `rewind`
+    std::size_t marker() const noexcept
+    {
+        return m_offset;
+    }
+
+    /** Releases every allocation made after `marker` was observed
+     *
+     * Does nothing if the offset is already below `marker`, e.g. when an older allocation was
+     * released by `deallocate` in the meantime.
+     */
+    void rewind(std::size_t const marker) noexcept
+    {
+        m_offset = std::min(m_offset, marker);
+    }
+
+    /// Releases every allocation
+    void reset() noexcept
+    {
+        m_offset = 0;
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    /// Number of bytes currently allocated, including alignment padding
+    std::size_t used_bytes() const noexcept
+    {
+        return m_offset;
+    }
+
+    /// Largest number of bytes allocated at once since construction
+    std::size_t high_water_mark() const noexcept
+    {
+        return m_high_water_mark;
+    }
+};
+
+/** An allocator bumping the offset of a `ScratchArena`, usable as the `Chunk` allocator.
+ *
+ * The allocator only refers to the arena, which must outlive the chunks it serves.
+ */
+template <class T, class MemorySpace = Kokkos::DefaultExecutionSpace::memory_space>
+class ArenaAllocator
+{
+    template <class, class>
+    friend class ArenaAllocator;
+
+    ScratchArena<MemorySpace>* m_arena = nullptr;
+
+public:
+    using value_type = T;
+
+    using memory_space = MemorySpace;
+
+    template <class U>
+    struct rebind
+    {
+        using other = ArenaAllocator<U, MemorySpace>;
+    };
+
+    ArenaAllocator() = default;
+
+    explicit ArenaAllocator(ScratchArena<MemorySpace>& arena) noexcept : m_arena(&arena) {}
+
+    ArenaAllocator(ArenaAllocator const& x) = default;
+
+    ArenaAllocator(ArenaAllocator&& x) noexcept = default;
+
+    template <class U>
+    explicit ArenaAllocator(ArenaAllocator<U, MemorySpace> const& x) noexcept
+        : m_arena(x.m_arena)
+    {
+    }
+
+    ~ArenaAllocator() = default;
+
+    ArenaAllocator& operator=(ArenaAllocator const& x) = default;
+
+    ArenaAllocator& operator=(ArenaAllocator&& x) noexcept = default;
+
+    template <class U>
+    ArenaAllocator& operator=(ArenaAllocator<U, MemorySpace> const& x) noexcept
+    {
+        m_arena = x.m_arena;
+        return *this;
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n) const
+    {
+        assert(m_arena != nullptr);
+        return static_cast<T*>(m_arena->allocate(
+                sizeof(T) * n,
+                std::max(alignof(T), ScratchArena<MemorySpace>::default_alignment)));
+    }
+
+    [[nodiscard]] T* allocate([[maybe_unused]] std::string const& label, std::size_t n) const
+    {
+        return allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) const
+    {
+        assert(m_arena != nullptr);
+        m_arena->deallocate(p, sizeof(T) * n);
+    }
+
+    /// The arena this allocator draws from, nullptr if none
+    ScratchArena<MemorySpace>* arena() const noexcept
+    {
+        return m_arena;
+    }
+};
+
+template <class T, class MST, class U, class MSU>
+bool operator==(ArenaAllocator<T, MST> const& lhs, ArenaAllocator<U, MSU> const& rhs) noexcept
+{
+    if constexpr (std::is_same_v<MST, MSU>) {
+        return lhs.arena() == rhs.arena();
+    } else {
+        return false;
+    }
+}
+
+template <class T, class MST, class U, class MSU>
+bool operator!=(ArenaAllocator<T, MST> const& lhs, ArenaAllocator<U, MSU> const& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+} // namespace ddc
@@ -112,6 +112,25 @@ public:
         {
             return m_origin + continuous_element_type(icoord.uid()) * m_step;
         }
+
+        /** @brief Convert a position in `CDim` into the index of the cell containing it
+         *
+         * The cell `i` is \f$[x_i, x_{i+1}[\f$. The position must not be before the origin.
+         */
+        KOKKOS_FUNCTION discrete_element_type
+        find_cell(continuous_element_type const& x) const noexcept
+        {
+            assert(x >= m_origin);
+            Real const t = (x - m_origin) / m_step;
+            discrete_element_type icell(static_cast<DiscreteElementType>(t));
+            // Stay consistent with `coordinate` despite the rounding errors
+            if (icell.uid() > 0 && coordinate(icell) > x) {
+                --icell;
+            } else if (coordinate(icell + 1) <= x) {
+                ++icell;
+            }
+            return icell;
+        }
     };
 
     /** Construct a Impl<Kokkos::HostSpace> and associated discrete_domain_type from a segment
@@ -235,6 +254,14 @@ KOKKOS_FUNCTION constexpr Coordinate<typename DDim::continuous_dimension_type> c
     return discrete_space<DDim>().coordinate(c);
 }
 
+/// @brief Index of the cell containing `x`, the cell `i` being \f$[x_i, x_{i+1}[\f$
+template <class DDim, std::enable_if_t<is_uniform_point_sampling_v<DDim>, int> = 0>
+KOKKOS_FUNCTION DiscreteElement<DDim> find_cell(
+        Coordinate<typename DDim::continuous_dimension_type> const& x)
+{
+    return discrete_space<DDim>().find_cell(x);
+}
+
 /// @brief Lower bound index of the mesh
 template <class DDim>
 KOKKOS_FUNCTION std::enable_if_t<
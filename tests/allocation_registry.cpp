@@ -0,0 +1,101 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <sstream>
+#include <string>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(ALLOCATION_REGISTRY_CPP)
+{
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+    using DDomX = ddc::DiscreteDomain<DDimX>;
+
+} // namespace )
+
+TEST(AllocationRegistryTest, CurrentAndPeak)
+{
+    ddc::AllocationRegistry registry;
+    int a;
+    int b;
+    int c;
+    registry.register_allocation("Host", "a", &a, 100);
+    registry.register_allocation("Host", "a", &b, 50);
+    registry.register_allocation("Device", "a", &c, 10);
+    EXPECT_EQ(registry.nb_live_allocations(), 3);
+    registry.register_deallocation(&a);
+    registry.register_deallocation(&a);
+    EXPECT_EQ(registry.nb_live_allocations(), 2);
+
+    ddc::AllocationStatistics const host_a = registry.statistics("Host", "a");
+    EXPECT_EQ(host_a.current_bytes, 50);
+    EXPECT_EQ(host_a.peak_bytes, 150);
+    EXPECT_EQ(host_a.nb_allocations, 2);
+    EXPECT_EQ(registry.statistics("Device", "a").peak_bytes, 10);
+    EXPECT_EQ(registry.statistics("Host").current_bytes, 50);
+    EXPECT_EQ(registry.statistics("Host", "b").nb_allocations, 0);
+
+    registry.reset();
+    EXPECT_EQ(registry.statistics("Host", "a").peak_bytes, 50);
+    EXPECT_EQ(registry.statistics("Host", "a").nb_allocations, 0);
+}
+
+TEST(AllocationRegistryTest, Dump)
+{
+    ddc::AllocationRegistry registry;
+    int a;
+    int b;
+    registry.register_allocation("Host", "small", &a, 8);
+    registry.register_allocation("Host", "large", &b, 800);
+    std::ostringstream oss;
+    registry.dump(oss);
+    std::string const dump = oss.str();
+    EXPECT_NE(dump.find("Allocations in Host: current 808 B, peak 808 B"), std::string::npos);
+    EXPECT_LT(dump.find("large"), dump.find("small"));
+}
+
+TEST(AllocationRegistryTest, ChunkLabels)
+{
+    std::string const space = Kokkos::HostSpace::name();
+    std::string const label = "allocation-registry-test";
+    ddc::AllocationRegistry& registry = ddc::allocation_registry();
+    registry.enable();
+    {
+        ddc::Chunk chunk(label, DDomX(DElemX(0), DVectX(10)), ddc::HostAllocator<double>());
+        EXPECT_EQ(registry.statistics(space, label).current_bytes, 10 * sizeof(double));
+        {
+            ddc::Chunk chunk2(label, DDomX(DElemX(0), DVectX(5)), ddc::HostAllocator<double>());
+        }
+        EXPECT_EQ(registry.statistics(space, label).current_bytes, 10 * sizeof(double));
+    }
+    registry.disable();
+    ddc::AllocationStatistics const statistics = registry.statistics(space, label);
+    EXPECT_EQ(statistics.current_bytes, 0);
+    EXPECT_EQ(statistics.peak_bytes, 15 * sizeof(double));
+    EXPECT_EQ(statistics.nb_allocations, 2);
+}
+
+TEST(AllocationRegistryTest, DeallocateWhileDisabled)
+{
+    std::string const space = Kokkos::HostSpace::name();
+    std::string const label = "allocation-registry-disabled-test";
+    ddc::AllocationRegistry& registry = ddc::allocation_registry();
+    std::size_t const nb_live_allocations = registry.nb_live_allocations();
+    {
+        registry.enable();
+        ddc::Chunk chunk(label, DDomX(DElemX(0), DVectX(10)), ddc::HostAllocator<double>());
+        registry.disable();
+        EXPECT_EQ(registry.nb_live_allocations(), nb_live_allocations + 1);
+    }
+    EXPECT_EQ(registry.nb_live_allocations(), nb_live_allocations);
+    ddc::AllocationStatistics const statistics = registry.statistics(space, label);
+    EXPECT_EQ(statistics.current_bytes, 0);
+    EXPECT_EQ(statistics.peak_bytes, 10 * sizeof(double));
+}
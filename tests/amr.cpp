@@ -0,0 +1,221 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+#include <ddc/experimental/amr.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace ddcexp = ddc::experimental;
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(AMR_CPP)
+{
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+    using DDomX = ddc::DiscreteDomain<DDimX>;
+
+    using LevelX = ddc::MultiPatchDomain<DDimX>;
+
+    struct DDimY
+    {
+    };
+
+    using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+    using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+    using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+    using LevelXY = ddc::MultiPatchDomain<DDimX, DDimY>;
+
+    template <class ElementType>
+    using DeviceLevelChunk
+            = ddc::MultiPatchChunk<ElementType, LevelXY, ddc::DeviceAllocator<ElementType>>;
+
+} // namespace )
+
+TEST(Amr, RefineCoarsen)
+{
+    DDomXY const box(DElemXY(3, 4), DVectXY(2, 5));
+    EXPECT_EQ(ddcexp::refine(box, 2), DDomXY(DElemXY(6, 8), DVectXY(4, 10)));
+    EXPECT_EQ(ddcexp::coarsen(box, 2), DDomXY(DElemXY(1, 2), DVectXY(2, 3)));
+    EXPECT_EQ(ddcexp::coarsen(ddcexp::refine(box, 3), 3), box);
+}
+
+TEST(Amr, SetLevel)
+{
+    ddcexp::AmrHierarchy<DDimX> hierarchy(DDomX(DElemX(0), DVectX(16)), 2);
+    EXPECT_EQ(hierarchy.nb_levels(), 1);
+    EXPECT_THROW(
+            hierarchy.set_level(1, std::vector<DDomX> {DDomX(DElemX(3), DVectX(4))}),
+            std::runtime_error);
+    EXPECT_THROW(
+            hierarchy.set_level(1, std::vector<DDomX> {DDomX(DElemX(28), DVectX(8))}),
+            std::runtime_error);
+    hierarchy.set_level(1, std::vector<DDomX> {DDomX(DElemX(4), DVectX(8))});
+    hierarchy.set_level(2, std::vector<DDomX> {DDomX(DElemX(8), DVectX(4))});
+    EXPECT_EQ(hierarchy.nb_levels(), 3);
+    hierarchy.set_level(1, std::vector<DDomX> {DDomX(DElemX(0), DVectX(4))});
+    EXPECT_EQ(hierarchy.nb_levels(), 2);
+    EXPECT_EQ(hierarchy.level(1).patch(0), DDomX(DElemX(0), DVectX(4)));
+}
+
+TEST(Amr, SubtractBoxes)
+{
+    DDomXY const box(DElemXY(0, 0), DVectXY(4, 4));
+    std::vector<DDomXY> const outside
+            = ddc::detail::subtract_boxes(box, DDomXY(DElemXY(2, 1), DVectXY(4, 2)));
+    ASSERT_EQ(outside.size(), 3);
+    EXPECT_EQ(outside[0], DDomXY(DElemXY(0, 0), DVectXY(2, 4)));
+    EXPECT_EQ(outside[1], DDomXY(DElemXY(2, 0), DVectXY(2, 1)));
+    EXPECT_EQ(outside[2], DDomXY(DElemXY(2, 3), DVectXY(2, 1)));
+    std::vector<DDomXY> const disjoint
+            = ddc::detail::subtract_boxes(box, DDomXY(DElemXY(5, 5), DVectXY(1, 1)));
+    ASSERT_EQ(disjoint.size(), 1);
+    EXPECT_EQ(disjoint[0], box);
+    EXPECT_TRUE(ddc::detail::subtract_boxes(box, box).empty());
+}
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(AMR_CPP)
+{
+    void TestAmrRegrid1D()
+    {
+        LevelX const coarsest(std::vector<DDomX> {DDomX(DElemX(0), DVectX(32))});
+        ddcexp::AmrHierarchy<DDimX> hierarchy(coarsest, 2);
+        ddc::MultiPatchChunk<int, LevelX, ddc::DeviceAllocator<int>> flags_alloc(coarsest);
+        auto const flags = flags_alloc.span_view();
+        ddc::parallel_for_each(
+                coarsest,
+                KOKKOS_LAMBDA(std::size_t const p, DElemX const ix) {
+                    flags(p, ix) = (ddc::uid<DDimX>(ix) == 5 || ddc::uid<DDimX>(ix) == 9) ? 1 : 0;
+                });
+        hierarchy.regrid(0, flags, 4);
+        // The consecutive flagged tiles [4, 8) and [8, 12) are merged
+        ASSERT_EQ(hierarchy.nb_levels(), 2);
+        ASSERT_EQ(hierarchy.level(1).nb_patches(), 1);
+        EXPECT_EQ(hierarchy.level(1).patch(0), DDomX(DElemX(8), DVectX(16)));
+
+        ddc::parallel_for_each(
+                coarsest,
+                KOKKOS_LAMBDA(std::size_t const p, DElemX const ix) { flags(p, ix) = 0; });
+        hierarchy.regrid(0, flags, 4);
+        EXPECT_EQ(hierarchy.nb_levels(), 1);
+        EXPECT_THROW(hierarchy.regrid(0, flags, 0), std::runtime_error);
+    }
+
+} // namespace )
+
+TEST(Amr, Regrid1D)
+{
+    TestAmrRegrid1D();
+}
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(AMR_CPP)
+{
+    void TestAmrTransfers2D()
+    {
+        ddcexp::AmrHierarchy<DDimX, DDimY> hierarchy(DDomXY(DElemXY(0, 0), DVectXY(16, 16)), 2);
+        LevelXY const coarse = hierarchy.level(0);
+        DeviceLevelChunk<int> flags_alloc(coarse);
+        auto const flags = flags_alloc.span_view();
+        ddc::parallel_for_each(
+                coarse,
+                KOKKOS_LAMBDA(std::size_t const p, DElemXY const ixy) {
+                    std::size_t const x = ddc::uid<DDimX>(ixy);
+                    std::size_t const y = ddc::uid<DDimY>(ixy);
+                    flags(p, ixy) = (x >= 3 && x <= 5 && y == 6) ? 1 : 0;
+                });
+        hierarchy.regrid(0, flags, 4);
+        ASSERT_EQ(hierarchy.nb_levels(), 2);
+        LevelXY const fine = hierarchy.level(1);
+        ASSERT_EQ(fine.nb_patches(), 2);
+        EXPECT_EQ(fine.patch(0), DDomXY(DElemXY(0, 8), DVectXY(8, 8)));
+        EXPECT_EQ(fine.patch(1), DDomXY(DElemXY(8, 8), DVectXY(8, 8)));
+
+        DeviceLevelChunk<double> coarse_values_alloc(coarse);
+        DeviceLevelChunk<double> fine_values_alloc(fine);
+        auto const coarse_values = coarse_values_alloc.span_view();
+        auto const fine_values = fine_values_alloc.span_view();
+        ddc::parallel_for_each(
+                coarse,
+                KOKKOS_LAMBDA(std::size_t const p, DElemXY const ixy) {
+                    coarse_values(p, ixy) = 10. * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy);
+                });
+        hierarchy.prolongate(0, coarse_values, fine_values);
+        for (std::size_t p = 0; p < fine.nb_patches(); ++p) {
+            auto const fine_host = ddc::create_mirror_view_and_copy(fine_values_alloc.patch(p));
+            ddc::for_each(fine_host.domain(), [&](DElemXY const ixy) {
+                EXPECT_EQ(
+                        fine_host(ixy),
+                        10. * (ddc::uid<DDimX>(ixy) / 2) + ddc::uid<DDimY>(ixy) / 2);
+            });
+        }
+
+        ddc::parallel_for_each(
+                fine,
+                KOKKOS_LAMBDA(std::size_t const p, DElemXY const ixy) {
+                    fine_values(p, ixy) = 1000. + ddc::uid<DDimX>(ixy);
+                });
+        hierarchy.average_down(0, fine_values, coarse_values);
+        auto const coarse_host = ddc::create_mirror_view_and_copy(coarse_values_alloc.patch(0));
+        EXPECT_EQ(coarse_host(DElemXY(1, 5)), 1002.5);
+        EXPECT_EQ(coarse_host(DElemXY(7, 4)), 1014.5);
+        EXPECT_EQ(coarse_host(DElemXY(10, 10)), 110.);
+        EXPECT_EQ(coarse_host(DElemXY(1, 3)), 13.);
+    }
+
+} // namespace )
+
+TEST(Amr, Transfers2D)
+{
+    TestAmrTransfers2D();
+}
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(AMR_CPP)
+{
+    void TestAmrOverlappingPatches()
+    {
+        ddcexp::AmrHierarchy<DDimX> hierarchy(DDomX(DElemX(0), DVectX(16)), 2);
+        // The fine patches overlap on [8, 12), i.e. on the coarse cells [4, 6)
+        hierarchy.set_level(
+                1,
+                std::vector<DDomX> {DDomX(DElemX(4), DVectX(8)), DDomX(DElemX(8), DVectX(8))});
+        LevelX const coarse = hierarchy.level(0);
+        LevelX const fine = hierarchy.level(1);
+        ddc::MultiPatchChunk<double, LevelX, ddc::DeviceAllocator<double>> coarse_values_alloc(
+                coarse);
+        ddc::MultiPatchChunk<double, LevelX, ddc::DeviceAllocator<double>> fine_values_alloc(fine);
+        auto const coarse_values = coarse_values_alloc.span_view();
+        auto const fine_values = fine_values_alloc.span_view();
+        ddc::parallel_for_each(
+                coarse,
+                KOKKOS_LAMBDA(std::size_t const p, DElemX const ix) {
+                    coarse_values(p, ix) = ddc::uid<DDimX>(ix);
+                });
+        ddc::parallel_for_each(
+                fine,
+                KOKKOS_LAMBDA(std::size_t const p, DElemX const ix) {
+                    fine_values(p, ix) = 100. + ddc::uid<DDimX>(ix);
+                });
+        hierarchy.average_down(0, fine_values, coarse_values);
+        auto const coarse_host = ddc::create_mirror_view_and_copy(coarse_values_alloc.patch(0));
+        ddc::for_each(coarse_host.domain(), [&](DElemX const ix) {
+            std::size_t const x = ddc::uid<DDimX>(ix);
+            EXPECT_EQ(coarse_host(ix), (x >= 2 && x < 8) ? 100.5 + 2. * x : double(x));
+        });
+    }
+
+} // namespace )
+
+TEST(Amr, OverlappingPatches)
+{
+    TestAmrOverlappingPatches();
+}
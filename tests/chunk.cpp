@@ -377,7 +377,16 @@ TEST(Chunk1DTest, DomainX)
 
 // TODO: internal_mdspan
 
-// TODO: allocation_mdspan
+TEST(Chunk1DTest, AllocationMdspan)
+{
+    ChunkX<double> chunk(dom_x);
+    auto const allocation_mdspan = chunk.allocation_mdspan();
+    EXPECT_TRUE((std::is_same_v<
+                 typename decltype(allocation_mdspan)::layout_type,
+                 std::experimental::layout_right>));
+    EXPECT_EQ(allocation_mdspan.data_handle(), chunk.data_handle());
+    EXPECT_EQ(&allocation_mdspan(1), &chunk(lbound_x + 1));
+}
 
 TEST(Chunk1DTest, GetDomainX)
 {
@@ -518,6 +527,25 @@ TEST(Chunk2DTest, SliceDomainX)
     }
 }
 
+TEST(Chunk2DTest, ToStridedSpan)
+{
+    ChunkXY<double> chunk(dom_x_y);
+    for (auto&& ix : chunk.domain<DDimX>()) {
+        for (auto&& iy : chunk.domain<DDimY>()) {
+            chunk(ix, iy) = 1. * ix.uid() + .001 * iy.uid();
+        }
+    }
+    ddc::ChunkSpan<double, DDomXY, std::experimental::layout_stride> const span = chunk;
+    ddc::ChunkSpan<double const, DDomXY, std::experimental::layout_stride> const cspan
+            = std::as_const(chunk);
+    for (auto&& ix : chunk.domain<DDimX>()) {
+        for (auto&& iy : chunk.domain<DDimY>()) {
+            EXPECT_EQ(span(ix, iy), chunk(ix, iy));
+            EXPECT_EQ(cspan(ix, iy), chunk(ix, iy));
+        }
+    }
+}
+
 TEST(Chunk2DTest, SliceDomainY)
 {
     DDomY const subdomain_y(lbound_y + 1, nelems_y - 2);
@@ -583,6 +611,22 @@ TEST(Chunk2DTest, DeepcopyReordered)
     }
 }
 
+TEST(Chunk2DTest, FirstTouch)
+{
+    ddc::Chunk chunk(
+            Kokkos::DefaultHostExecutionSpace(),
+            "first-touch-test",
+            dom_x_y,
+            ddc::HostAllocator<double>());
+    Kokkos::DefaultHostExecutionSpace().fence();
+    EXPECT_EQ(chunk.label(), std::string_view("first-touch-test"));
+    for (auto&& ix : chunk.domain<DDimX>()) {
+        for (auto&& iy : chunk.domain<DDimY>()) {
+            EXPECT_EQ(chunk(ix, iy), 0.);
+        }
+    }
+}
+
 TEST(Chunk3DTest, AccessFromDiscreteElements)
 {
     using DDomXYZ = ddc::DiscreteDomain<DDimX, DDimY, DDimZ>;
@@ -614,3 +658,42 @@ TEST(Chunk2DTest, Mirror)
         }
     }
 }
+
+TEST(Chunk2DTest, LayoutLeft)
+{
+    ddc::Chunk<double, DDomXY, ddc::HostAllocator<double>, std::experimental::layout_left> chunk(
+            dom_x_y);
+    EXPECT_EQ(chunk.stride<DDimX>(), 1);
+    EXPECT_EQ(chunk.stride<DDimY>(), nelems_x.value());
+    for (auto&& ix : chunk.domain<DDimX>()) {
+        for (auto&& iy : chunk.domain<DDimY>()) {
+            chunk(ix, iy) = 1.739 * ix.uid() + 1.412 * iy.uid();
+        }
+    }
+    EXPECT_EQ(chunk.data_handle()[1], chunk(lbound_x + 1, lbound_y));
+    ChunkXY<double> chunk2(chunk.domain());
+    ddc::parallel_deepcopy(chunk2, chunk);
+    for (auto&& ix : chunk.domain<DDimX>()) {
+        for (auto&& iy : chunk.domain<DDimY>()) {
+            // we expect complete equality, not EXPECT_DOUBLE_EQ: these are copy
+            EXPECT_EQ(chunk2(ix, iy), chunk(ix, iy));
+        }
+    }
+}
+
+TEST(Chunk2DTest, MirrorLayoutLeft)
+{
+    ddc::Chunk<double, DDomXY, ddc::HostAllocator<double>, std::experimental::layout_left> chunk(
+            dom_x_y);
+    ddc::parallel_fill(chunk, 1.4);
+    auto const chunk2 = ddc::create_mirror_and_copy(chunk.span_cview());
+    EXPECT_TRUE((std::is_same_v<
+                 typename std::remove_const_t<decltype(chunk2)>::layout_type,
+                 std::experimental::layout_left>));
+    for (auto&& ix : chunk.domain<DDimX>()) {
+        for (auto&& iy : chunk.domain<DDimY>()) {
+            // we expect complete equality, not EXPECT_DOUBLE_EQ: these are copy
+            EXPECT_EQ(chunk2(ix, iy), chunk(ix, iy));
+        }
+    }
+}
@@ -0,0 +1,142 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(CONVERTING_SPAN_CPP)
+{
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+    using DDomX = ddc::DiscreteDomain<DDimX>;
+
+    struct DDimY
+    {
+    };
+    using DElemY = ddc::DiscreteElement<DDimY>;
+    using DVectY = ddc::DiscreteVector<DDimY>;
+
+    using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+    using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+    using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+    static DDomXY constexpr dom_x_y(DElemXY(1, 3), DVectXY(5, 6));
+
+    void TestConvertingSpanParallelDeepcopy()
+    {
+        ddc::Chunk<double, DDomXY, ddc::DeviceAllocator<double>> values_alloc(dom_x_y);
+        auto const values = values_alloc.span_view();
+        ddc::parallel_for_each(
+                dom_x_y,
+                KOKKOS_LAMBDA(DElemXY const ixy) {
+                    values(ixy) = 1. / (1 + ddc::uid<DDimX>(ixy) + 10 * ddc::uid<DDimY>(ixy));
+                });
+        ddc::Chunk<float, DDomXY, ddc::DeviceAllocator<float>> chunk(dom_x_y);
+        ddc::parallel_deepcopy(ddc::converting_view<double>(chunk), values);
+        // The copy back starts from another element of the same extents
+        DDomXY const shifted_dom(DElemXY(7, 0), dom_x_y.extents());
+        ddc::Chunk<double, DDomXY, ddc::DeviceAllocator<double>> copy(shifted_dom);
+        ddc::parallel_deepcopy(copy, ddc::converting_cview<double>(chunk));
+
+        auto const values_host = ddc::create_mirror_view_and_copy(values);
+        auto const chunk_host = ddc::create_mirror_view_and_copy(chunk.span_view());
+        auto const copy_host = ddc::create_mirror_view_and_copy(copy.span_view());
+        ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+            float const expected = static_cast<float>(values_host(ixy));
+            EXPECT_EQ(chunk_host(ixy), expected);
+            EXPECT_EQ(
+                    copy_host(shifted_dom.front() + (ixy - dom_x_y.front())),
+                    static_cast<double>(expected));
+        });
+    }
+
+} // namespace )
+
+TEST(ConvertingSpanTest, Types)
+{
+    ddc::Chunk<float, DDomXY> chunk(dom_x_y);
+    auto const span = ddc::converting_view<double>(chunk);
+    auto const view = ddc::converting_cview<double>(chunk);
+    EXPECT_TRUE((std::is_same_v<decltype(span)::element_type, double>));
+    EXPECT_TRUE((std::is_same_v<decltype(view)::element_type, double const>));
+    EXPECT_TRUE((std::is_same_v<decltype(view)::reference, double>));
+    EXPECT_TRUE((std::is_same_v<decltype(span(dom_x_y.front()) + 1.), double>));
+}
+
+TEST(ConvertingSpanTest, LoadAndStore)
+{
+    ddc::Chunk<float, DDomXY> chunk(dom_x_y);
+    auto const span = ddc::converting_view<double>(chunk);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        span(ixy) = 0.5 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy);
+        span(ixy) += 0.25;
+        span(ixy) *= 2.;
+    });
+    auto const view = ddc::converting_cview<double>(chunk);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        float const expected = static_cast<float>(
+                (0.5 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy) + 0.25) * 2.);
+        EXPECT_EQ(chunk(ixy), expected);
+        EXPECT_EQ(view(ixy), static_cast<double>(expected));
+    });
+}
+
+TEST(ConvertingSpanTest, StoreIsRounded)
+{
+    ddc::Chunk<float, DDomX> chunk(DDomX(DElemX(0), DVectX(1)));
+    auto const span = ddc::converting_view<double>(chunk);
+    double const x = 1. / 3.;
+    span(DElemX(0)) = x;
+    EXPECT_EQ(chunk(DElemX(0)), static_cast<float>(x));
+    EXPECT_NE(static_cast<double>(span(DElemX(0))), x);
+}
+
+TEST(ConvertingSpanTest, Slice)
+{
+    ddc::Chunk<float, DDomXY> chunk(dom_x_y);
+    ddc::parallel_fill(chunk, 1.f);
+    auto const span = ddc::converting_view<double>(chunk);
+    DElemX const ix(2);
+    auto const row = span[ix];
+    EXPECT_EQ(row.domain(), ddc::select<DDimY>(dom_x_y));
+    ddc::for_each(row.domain(), [&](DElemY const iy) { row(iy) = 3.; });
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        EXPECT_EQ(chunk(ixy), ddc::select<DDimX>(ixy) == ix ? 3.f : 1.f);
+    });
+}
+
+TEST(ConvertingSpanTest, AllocationMdspan)
+{
+    ddc::Chunk<float, DDomXY> chunk(dom_x_y);
+    ddc::parallel_fill(chunk, 2.f);
+    auto const span = ddc::converting_view<double>(chunk);
+    auto const mdspan = span.allocation_mdspan();
+    mdspan(1, 2) = 4.;
+    EXPECT_EQ(chunk(dom_x_y.front() + DVectXY(1, 2)), 4.f);
+    double const value = mdspan(0, 0);
+    EXPECT_EQ(value, 2.);
+}
+
+TEST(ConvertingSpanTest, ParallelFill)
+{
+    ddc::Chunk<float, DDomXY> chunk(dom_x_y);
+    auto const span = ddc::converting_view<double>(chunk);
+    EXPECT_TRUE((ddc::is_borrowed_chunk_v<decltype(span)>));
+    double const x = 1. / 3.;
+    ddc::parallel_fill(span, x);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        EXPECT_EQ(chunk(ixy), static_cast<float>(x));
+    });
+}
+
+TEST(ConvertingSpanTest, ParallelDeepcopy)
+{
+    TestConvertingSpanParallelDeepcopy();
+}
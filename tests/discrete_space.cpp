@@ -2,10 +2,15 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <stdexcept>
+#include <vector>
+
 #include <ddc/ddc.hpp>
 
 #include <gtest/gtest.h>
 
+#include <Kokkos_Core.hpp>
+
 namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(DISCRETE_SPACE_CPP)
 {
     struct DimX;
@@ -13,6 +18,14 @@ namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(DISCRETE_SPACE_CPP)
     {
     };
 
+    struct DDimXReinit : ddc::UniformPointSampling<DimX>
+    {
+    };
+
+    struct DDimXNonUniform : ddc::NonUniformPointSampling<DimX>
+    {
+    };
+
 } // namespace )
 
 TEST(DiscreteSpace, IsDiscreteSpaceInitialized)
@@ -24,3 +37,69 @@ TEST(DiscreteSpace, IsDiscreteSpaceInitialized)
             ddc::DiscreteVector<DDimX>(2)));
     EXPECT_TRUE(ddc::is_discrete_space_initialized<DDimX>());
 }
+
+TEST(DiscreteSpace, Reinit)
+{
+    EXPECT_THROW(
+            ddc::reinit_discrete_space<DDimXReinit>(ddc::Coordinate<DimX>(0), 1.),
+            std::runtime_error);
+    EXPECT_EQ(ddc::discrete_space_version<DDimXReinit>(), 0);
+    ddc::init_discrete_space<DDimXReinit>(ddc::Coordinate<DimX>(0), 1.);
+    EXPECT_EQ(ddc::discrete_space_version<DDimXReinit>(), 1);
+    ddc::DiscreteDomain<DDimXReinit> const domain_x = ddc::reinit_discrete_space<DDimXReinit>(
+            DDimXReinit::template init<DDimXReinit>(
+                    ddc::Coordinate<DimX>(1),
+                    ddc::Coordinate<DimX>(2),
+                    ddc::DiscreteVector<DDimXReinit>(5)));
+    EXPECT_EQ(ddc::discrete_space_version<DDimXReinit>(), 2);
+    EXPECT_DOUBLE_EQ(ddc::coordinate(domain_x.front()), 1.);
+    EXPECT_DOUBLE_EQ(ddc::step<DDimXReinit>(), 0.25);
+}
+
+void TestDiscreteSpaceReinitInPlace()
+{
+    ddc::init_discrete_space<DDimXNonUniform>(
+            std::vector<ddc::Coordinate<DimX>> {
+                    ddc::Coordinate<DimX>(0.),
+                    ddc::Coordinate<DimX>(1.),
+                    ddc::Coordinate<DimX>(3.)});
+    auto const& dual = *ddc::detail::g_discrete_space_dual<DDimXNonUniform>;
+    auto const* const host_points = dual.get_host().points().data();
+    auto const* const device_points = dual.get_device().points().data();
+    ddc::reinit_discrete_space<DDimXNonUniform>(std::vector<ddc::Coordinate<DimX>> {
+            ddc::Coordinate<DimX>(0.),
+            ddc::Coordinate<DimX>(2.),
+            ddc::Coordinate<DimX>(3.)});
+    EXPECT_EQ(ddc::discrete_space_version<DDimXNonUniform>(), 2);
+    // Same number of points: the points are updated in place
+    EXPECT_EQ(dual.get_host().points().data(), host_points);
+    EXPECT_EQ(dual.get_device().points().data(), device_points);
+    EXPECT_EQ(
+            ddc::host_discrete_space<DDimXNonUniform>().coordinate(
+                    ddc::DiscreteElement<DDimXNonUniform>(1)),
+            ddc::Coordinate<DimX>(2.));
+
+    ddc::DiscreteDomain<DDimXNonUniform> const domain_x(
+            ddc::DiscreteElement<DDimXNonUniform>(0),
+            ddc::DiscreteVector<DDimXNonUniform>(3));
+    ddc::Chunk coords_alloc(domain_x, ddc::DeviceAllocator<double>());
+    ddc::ChunkSpan const coords = coords_alloc.span_view();
+    ddc::parallel_for_each(
+            domain_x,
+            KOKKOS_LAMBDA(ddc::DiscreteElement<DDimXNonUniform> const ix) {
+                coords(ix) = ddc::coordinate(ix);
+            });
+    auto const coords_host = ddc::create_mirror_view_and_copy(coords);
+    EXPECT_EQ(coords_host(ddc::DiscreteElement<DDimXNonUniform>(1)), 2.);
+
+    ddc::reinit_discrete_space<DDimXNonUniform>(std::vector<ddc::Coordinate<DimX>> {
+            ddc::Coordinate<DimX>(0.),
+            ddc::Coordinate<DimX>(1.)});
+    EXPECT_EQ(ddc::discrete_space_version<DDimXNonUniform>(), 3);
+    EXPECT_EQ(ddc::host_discrete_space<DDimXNonUniform>().size(), 2);
+}
+
+TEST(DiscreteSpace, ReinitInPlace)
+{
+    TestDiscreteSpaceReinitInPlace();
+}
@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: MIT
 
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 #include <ddc/ddc.hpp>
 
@@ -163,3 +165,29 @@ TEST(DiscreteVectorTest, ExternalBinaryOperatorMinus)
     EXPECT_EQ(ddc::get<DDimY>(result5), dv_y - dv2_y);
     EXPECT_EQ(ddc::get<DDimZ>(result5), dv_z - dv2_z);
 }
+
+TEST(DiscreteVectorTest, IndexType)
+{
+#ifdef DDC_BUILD_32BIT_INDICES
+    EXPECT_EQ(sizeof(ddc::DiscreteVectorElement), 4);
+    EXPECT_EQ(sizeof(ddc::DiscreteElementType), 4);
+#else
+    EXPECT_EQ(sizeof(ddc::DiscreteVectorElement), sizeof(std::ptrdiff_t));
+    EXPECT_EQ(sizeof(ddc::DiscreteElementType), sizeof(std::size_t));
+#endif
+    EXPECT_TRUE(std::is_signed_v<ddc::DiscreteVectorElement>);
+    EXPECT_TRUE(std::is_unsigned_v<ddc::DiscreteElementType>);
+}
+
+TEST(DiscreteVectorTest, InIndexRange)
+{
+    EXPECT_TRUE(ddc::detail::in_index_range<std::int32_t>(-1));
+    EXPECT_TRUE(ddc::detail::in_index_range<std::int32_t>(std::int64_t(2147483647)));
+    EXPECT_FALSE(ddc::detail::in_index_range<std::int32_t>(std::int64_t(2147483648)));
+    EXPECT_FALSE(ddc::detail::in_index_range<std::int32_t>(std::int64_t(-2147483649)));
+    EXPECT_FALSE(ddc::detail::in_index_range<std::uint32_t>(-1));
+    EXPECT_TRUE(ddc::detail::in_index_range<std::uint32_t>(std::size_t(4294967295)));
+    EXPECT_FALSE(ddc::detail::in_index_range<std::uint32_t>(std::size_t(4294967296)));
+    EXPECT_TRUE(ddc::detail::in_index_range<std::size_t>(std::size_t(4294967296)));
+    EXPECT_TRUE(ddc::detail::in_index_range<std::int32_t>(1.5));
+}
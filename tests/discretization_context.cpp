@@ -0,0 +1,92 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(DISCRETIZATION_CONTEXT_CPP)
+{
+    struct DimX;
+
+    struct DDimX : ddc::UniformPointSampling<DimX>
+    {
+    };
+
+    struct DDimY : ddc::NonUniformPointSampling<DimX>
+    {
+    };
+
+    struct DDimMember
+    {
+    };
+
+} // namespace )
+
+TEST(DiscretizationContext, Emplace)
+{
+    ddc::DiscretizationContext<DDimX> context;
+    EXPECT_EQ(context.size(), 0);
+    ddc::DiscretizationHandle<DDimX> const h0 = context.emplace(ddc::Coordinate<DimX>(0.), 1.);
+    auto const [h1, domain_x] = context.emplace(DDimX::init<DDimX>(
+            ddc::Coordinate<DimX>(1.),
+            ddc::Coordinate<DimX>(2.),
+            ddc::DiscreteVector<DDimX>(11)));
+    EXPECT_EQ(context.size(), 2);
+    EXPECT_NE(h0, h1);
+    EXPECT_EQ(domain_x.size(), 11);
+    EXPECT_DOUBLE_EQ(context.host(h0).step(), 1.);
+    EXPECT_DOUBLE_EQ(context.host(h1).step(), 0.1);
+    EXPECT_DOUBLE_EQ(context.host(h1).coordinate(domain_x.back()), 2.);
+    EXPECT_FALSE(ddc::is_discrete_space_initialized<DDimX>());
+}
+
+void TestDiscretizationContextBatched()
+{
+    ddc::DiscretizationContext<DDimY> context;
+    std::size_t const nb_members = 4;
+    ddc::DiscreteDomain<DDimY> const domain_y(
+            ddc::DiscreteElement<DDimY>(0),
+            ddc::DiscreteVector<DDimY>(5));
+    for (std::size_t m = 0; m < nb_members; ++m) {
+        double const dx = m + 1;
+        std::vector<ddc::Coordinate<DimX>> const points {
+                ddc::Coordinate<DimX>(0.),
+                ddc::Coordinate<DimX>(dx),
+                ddc::Coordinate<DimX>(3 * dx),
+                ddc::Coordinate<DimX>(4 * dx),
+                ddc::Coordinate<DimX>(6 * dx)};
+        context.emplace(points);
+    }
+    ddc::DiscreteDomain<DDimMember> const members(
+            ddc::DiscreteElement<DDimMember>(0),
+            ddc::DiscreteVector<DDimMember>(nb_members));
+    ddc::DiscreteDomain<DDimMember, DDimY> const domain(members, domain_y);
+    ddc::Chunk coords_alloc(domain, ddc::DeviceAllocator<double>());
+    ddc::ChunkSpan const coords = coords_alloc.span_view();
+    ddc::DiscretizationContextView<DDimY> const context_view = context.view();
+    EXPECT_EQ(context_view.size(), nb_members);
+    ddc::parallel_for_each(
+            domain,
+            KOKKOS_LAMBDA(ddc::DiscreteElement<DDimMember, DDimY> const i) {
+                ddc::DiscretizationHandle<DDimY> const handle(ddc::select<DDimMember>(i).uid());
+                coords(i) = context_view[handle].coordinate(ddc::select<DDimY>(i));
+            });
+    auto const coords_host = ddc::create_mirror_view_and_copy(coords_alloc.span_cview());
+    for (ddc::DiscreteElement<DDimMember, DDimY> const i : domain) {
+        ddc::DiscretizationHandle<DDimY> const handle(ddc::select<DDimMember>(i).uid());
+        double const expected = context.host(handle).coordinate(ddc::select<DDimY>(i));
+        EXPECT_EQ(coords_host(i), expected);
+    }
+}
+
+TEST(DiscretizationContext, Batched)
+{
+    TestDiscretizationContextBatched();
+}
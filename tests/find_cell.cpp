@@ -0,0 +1,169 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(FIND_CELL_CPP)
+{
+    struct DimX;
+
+    struct DDimUniform : ddc::UniformPointSampling<DimX>
+    {
+    };
+
+    struct DDimPeriodic : ddc::PeriodicSampling<DimX>
+    {
+    };
+
+    struct DDimNonUniform : ddc::NonUniformPointSampling<DimX>
+    {
+    };
+
+    struct DDimNonUniformBatch : ddc::NonUniformPointSampling<DimX>
+    {
+    };
+
+    struct DDimParticle
+    {
+    };
+
+    /// Points whose spacing grows geometrically, so that the buckets contain many points
+    std::vector<ddc::Coordinate<DimX>> geometric_points(std::size_t const n)
+    {
+        std::vector<ddc::Coordinate<DimX>> points;
+        double x = 0;
+        double dx = 1e-3;
+        for (std::size_t i = 0; i < n; ++i) {
+            points.emplace_back(x);
+            x += dx;
+            dx *= 1.1;
+        }
+        return points;
+    }
+
+} // namespace )
+
+TEST(FindCell, UniformImpl)
+{
+    DDimUniform::Impl<DDimUniform, Kokkos::HostSpace> const
+            ddim(ddc::Coordinate<DimX>(1.), 0.1);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(1.)).uid(), 0);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(1.05)).uid(), 0);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(1.25)).uid(), 2);
+    for (std::size_t i = 0; i < 1000; ++i) {
+        ddc::DiscreteElement<DDimUniform> const ix(i);
+        EXPECT_EQ(ddim.find_cell(ddim.coordinate(ix)), ix);
+    }
+}
+
+TEST(FindCell, PeriodicImpl)
+{
+    DDimPeriodic::Impl<DDimPeriodic, Kokkos::HostSpace> const
+            ddim(ddc::Coordinate<DimX>(0.), 1., 10);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(3.5)).uid(), 3);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(-0.5)).uid(), 9);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(10.2)).uid(), 0);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(-10.5)).uid(), 9);
+    for (std::size_t i = 0; i < 10; ++i) {
+        ddc::DiscreteElement<DDimPeriodic> const ix(i);
+        EXPECT_EQ(ddim.find_cell(ddim.coordinate(ix) + ddc::Coordinate<DimX>(0.5)), ix);
+    }
+}
+
+TEST(FindCell, NonUniformImpl)
+{
+    DDimNonUniform::Impl<DDimNonUniform, Kokkos::HostSpace> const ddim(
+            {ddc::Coordinate<DimX>(0.),
+             ddc::Coordinate<DimX>(0.1),
+             ddc::Coordinate<DimX>(0.5),
+             ddc::Coordinate<DimX>(0.6),
+             ddc::Coordinate<DimX>(2.),
+             ddc::Coordinate<DimX>(5.)});
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(-1.)).uid(), 0);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(0.)).uid(), 0);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(0.05)).uid(), 0);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(0.1)).uid(), 1);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(0.55)).uid(), 2);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(1.)).uid(), 3);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(4.)).uid(), 4);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(5.)).uid(), 4);
+    EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(6.)).uid(), 4);
+}
+
+TEST(FindCell, NonUniformImplGeometric)
+{
+    std::vector<ddc::Coordinate<DimX>> const points = geometric_points(200);
+    DDimNonUniform::Impl<DDimNonUniform, Kokkos::HostSpace> const ddim(points);
+    for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+        ddc::DiscreteElement<DDimNonUniform> const ix(i);
+        EXPECT_EQ(ddim.find_cell(points[i]), ix);
+        double const middle = (points[i] + points[i + 1]) / 2;
+        EXPECT_EQ(ddim.find_cell(ddc::Coordinate<DimX>(middle)), ix);
+    }
+}
+
+TEST(FindCell, Domain)
+{
+    ddc::DiscreteDomain<DDimUniform> const domain_x = ddc::init_discrete_space<DDimUniform>(
+            DDimUniform::init<DDimUniform>(
+                    ddc::Coordinate<DimX>(0.),
+                    ddc::Coordinate<DimX>(1.),
+                    ddc::DiscreteVector<DDimUniform>(11)));
+    ddc::DiscreteDomain<DDimUniform> const
+            subdomain_x(domain_x.front() + 2, ddc::DiscreteVector<DDimUniform>(5));
+    EXPECT_EQ(ddc::find_cell<DDimUniform>(ddc::Coordinate<DimX>(0.35)), domain_x.front() + 3);
+    EXPECT_EQ(ddc::find_cell(subdomain_x, ddc::Coordinate<DimX>(0.35)), domain_x.front() + 3);
+    EXPECT_EQ(ddc::find_cell(subdomain_x, ddc::Coordinate<DimX>(0.05)), subdomain_x.front());
+    EXPECT_EQ(ddc::find_cell(subdomain_x, ddc::Coordinate<DimX>(0.6)), subdomain_x.back() - 1);
+    EXPECT_EQ(ddc::find_cell(subdomain_x, ddc::Coordinate<DimX>(0.9)), subdomain_x.back() - 1);
+}
+
+void TestFindCellParallel()
+{
+    std::vector<ddc::Coordinate<DimX>> const points = geometric_points(100);
+    ddc::DiscreteDomain<DDimNonUniformBatch> const domain_x
+            = ddc::init_discrete_space<DDimNonUniformBatch>(
+                    DDimNonUniformBatch::init<DDimNonUniformBatch>(points));
+
+    ddc::DiscreteDomain<DDimParticle> const particles(
+            ddc::DiscreteElement<DDimParticle>(0),
+            ddc::DiscreteVector<DDimParticle>(1000));
+    ddc::Chunk coords_alloc(particles, ddc::DeviceAllocator<ddc::Coordinate<DimX>>());
+    ddc::ChunkSpan const coords = coords_alloc.span_view();
+    double const rmax = points.back();
+    ddc::parallel_for_each(
+            particles,
+            KOKKOS_LAMBDA(ddc::DiscreteElement<DDimParticle> const ip) {
+                coords(ip) = ddc::Coordinate<DimX>(rmax * (ip.uid() % 997) / 996.);
+            });
+    using cell_type = ddc::DiscreteElement<DDimNonUniformBatch>;
+    ddc::Chunk cells_alloc(particles, ddc::DeviceAllocator<cell_type>());
+    ddc::parallel_find_cell(domain_x, cells_alloc, coords);
+
+    auto const coords_host = ddc::create_mirror_view_and_copy(coords);
+    auto const cells_host = ddc::create_mirror_view_and_copy(cells_alloc.span_cview());
+    for (ddc::DiscreteElement<DDimParticle> const ip : particles) {
+        double const x = coords_host(ip);
+        auto const it = std::upper_bound(points.begin(), points.end(), x, [](double a, auto b) {
+            return a < b;
+        });
+        std::size_t const expected
+                = std::min<std::size_t>(std::distance(points.begin(), it) - 1, points.size() - 2);
+        EXPECT_EQ(cells_host(ip), domain_x.front() + expected);
+    }
+}
+
+TEST(FindCell, Parallel)
+{
+    TestFindCellParallel();
+}
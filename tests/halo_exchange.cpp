@@ -0,0 +1,100 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <array>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(HALO_EXCHANGE_CPP)
+{
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+    using DDomX = ddc::DiscreteDomain<DDimX>;
+
+    struct DDimY
+    {
+    };
+    using DElemY = ddc::DiscreteElement<DDimY>;
+    using DVectY = ddc::DiscreteVector<DDimY>;
+    using DDomY = ddc::DiscreteDomain<DDimY>;
+
+    using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+    using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+    using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+    static DElemXY constexpr lbound_x_y(DElemX(10), DElemY(20));
+    static DVectXY constexpr nelems_x_y(DVectX(5), DVectY(7));
+    static DDomXY constexpr dom_x_y(lbound_x_y, nelems_x_y);
+    static DDomXY constexpr ghosted_dom_x_y(lbound_x_y - DVectXY(2, 1), nelems_x_y + DVectXY(4, 2));
+
+    int value(DElemXY const ixy)
+    {
+        return static_cast<int>(100 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy));
+    }
+
+} // namespace )
+
+TEST(HaloExchange, Regions)
+{
+    ddc::HaloExchange const halo(dom_x_y, ghosted_dom_x_y);
+    EXPECT_EQ(halo.nb_regions(), 8);
+    EXPECT_EQ(halo.nb_ghost_points(), ghosted_dom_x_y.size() - dom_x_y.size());
+
+    DDomXY const half_ghosted_dom_x_y(
+            lbound_x_y - DVectXY(2, 0),
+            nelems_x_y + DVectXY(2, 0));
+    ddc::HaloExchange const half_halo(dom_x_y, half_ghosted_dom_x_y);
+    EXPECT_EQ(half_halo.nb_regions(), 1);
+    EXPECT_EQ(half_halo.nb_ghost_points(), 2 * nelems_x_y.get<DDimY>());
+}
+
+TEST(HaloExchange, Periodic)
+{
+    ddc::Chunk chunk(ghosted_dom_x_y, ddc::HostAllocator<int>());
+    ddc::parallel_fill(chunk, -1);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) { chunk(ixy) = value(ixy); });
+    ddc::HaloExchange const halo(dom_x_y, ghosted_dom_x_y, ddc::HaloMode::PERIODIC);
+    Kokkos::DefaultHostExecutionSpace const exec_space;
+    halo(exec_space, chunk);
+    exec_space.fence();
+    ddc::for_each(ghosted_dom_x_y, [&](DElemXY const ixy) {
+        DVectXY const offset = ixy - dom_x_y.front();
+        DElemXY const src(
+                ddc::select<DDimX>(dom_x_y.front())
+                        + (offset.get<DDimX>() + nelems_x_y.get<DDimX>())
+                                  % nelems_x_y.get<DDimX>(),
+                ddc::select<DDimY>(dom_x_y.front())
+                        + (offset.get<DDimY>() + nelems_x_y.get<DDimY>())
+                                  % nelems_x_y.get<DDimY>());
+        EXPECT_EQ(chunk(ixy), value(src));
+    });
+}
+
+TEST(HaloExchange, ReflectingAndConstant)
+{
+    ddc::Chunk chunk(ghosted_dom_x_y, ddc::HostAllocator<int>());
+    ddc::parallel_fill(chunk, -1);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) { chunk(ixy) = value(ixy); });
+    ddc::HaloExchange const
+            halo(dom_x_y,
+                 ghosted_dom_x_y,
+                 std::array {ddc::HaloMode::REFLECTING, ddc::HaloMode::CONSTANT});
+    Kokkos::DefaultHostExecutionSpace const exec_space;
+    halo(exec_space, chunk.span_view());
+    exec_space.fence();
+    DElemX const front_x = ddc::select<DDimX>(dom_x_y.front());
+    DElemX const back_x = ddc::select<DDimX>(dom_x_y.back());
+    DElemY const front_y = ddc::select<DDimY>(dom_x_y.front());
+    DElemY const back_y = ddc::select<DDimY>(dom_x_y.back());
+    EXPECT_EQ(chunk(front_x - 2, front_y), value(DElemXY(front_x + 2, front_y)));
+    EXPECT_EQ(chunk(back_x + 1, back_y), value(DElemXY(back_x - 1, back_y)));
+    EXPECT_EQ(chunk(front_x + 1, front_y - 1), value(DElemXY(front_x + 1, front_y)));
+    EXPECT_EQ(chunk(back_x, back_y + 1), value(DElemXY(back_x, back_y)));
+    EXPECT_EQ(chunk(front_x - 1, back_y + 1), value(DElemXY(front_x + 1, back_y)));
+}
@@ -0,0 +1,103 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(HUGE_PAGE_ALLOCATOR_CPP)
+{
+    using T = double;
+    using A = ddc::HugePageAllocator<T>;
+    using U = char;
+    using B = std::allocator_traits<A>::rebind_alloc<U>;
+
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+    using DDomX = ddc::DiscreteDomain<DDimX>;
+
+} // namespace )
+
+TEST(HugePageAllocatorTest, Traits)
+{
+    using traits = std::allocator_traits<A>;
+    EXPECT_TRUE((std::is_same_v<traits::allocator_type, A>));
+    EXPECT_TRUE((std::is_same_v<traits::value_type, T>));
+    EXPECT_TRUE((std::is_same_v<traits::pointer, T*>));
+    EXPECT_TRUE((std::is_same_v<traits::rebind_alloc<U>, ddc::HugePageAllocator<U>>));
+    EXPECT_TRUE((std::is_same_v<traits::is_always_equal, std::true_type>));
+    EXPECT_TRUE((std::is_same_v<A::memory_space, Kokkos::HostSpace>));
+}
+
+TEST(HugePageAllocatorTest, RebindCopyConstructor)
+{
+    EXPECT_TRUE((std::is_constructible_v<A, B const&>));
+}
+
+TEST(HugePageAllocatorTest, HugePageSize)
+{
+    std::size_t const page = ddc::detail::huge_page_size();
+    EXPECT_GE(page, 4096);
+    EXPECT_EQ(page & (page - 1), 0);
+    std::size_t const transparent_page = ddc::detail::transparent_huge_page_size();
+    EXPECT_GE(transparent_page, 4096);
+    EXPECT_EQ(transparent_page & (transparent_page - 1), 0);
+}
+
+TEST(HugePageAllocatorTest, RoundUp)
+{
+    std::size_t const page = ddc::detail::huge_page_size();
+    EXPECT_EQ(ddc::detail::round_up_to_page(1, page), page);
+    EXPECT_EQ(ddc::detail::round_up_to_page(page, page), page);
+    EXPECT_EQ(ddc::detail::round_up_to_page(page + 1, page), 2 * page);
+}
+
+TEST(HugePageAllocatorTest, AllocateDeallocate)
+{
+    std::size_t const n = 3 * ddc::detail::huge_page_size() / sizeof(T) + 5;
+    A const allocator;
+    T* const p = allocator.allocate(n);
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignof(T), 0);
+    p[0] = 1.;
+    p[n - 1] = 2.;
+    EXPECT_EQ(p[0] + p[n - 1], 3.);
+    // The pages granted depend on the system, but are the same for the whole allocation
+    ddc::HugePageStatus const status = ddc::huge_page_status(p);
+    EXPECT_EQ(ddc::huge_page_status(p + n / 2), status);
+    EXPECT_EQ(ddc::huge_page_status(p + n - 1), status);
+    // Transparent huge pages are only reported once granted
+    EXPECT_EQ(
+            status == ddc::HugePageStatus::TRANSPARENT,
+            status != ddc::HugePageStatus::HUGETLB && status != ddc::HugePageStatus::NONE
+                    && ddc::detail::transparent_huge_page_bytes(p, n * sizeof(T)) > 0);
+    allocator.deallocate(p, n);
+    EXPECT_EQ(ddc::huge_page_status(p), ddc::HugePageStatus::NONE);
+}
+
+TEST(HugePageAllocatorTest, UnknownPointer)
+{
+    double const x = 0.;
+    EXPECT_EQ(ddc::huge_page_status(&x), ddc::HugePageStatus::NONE);
+    ddc::detail::HugePageMapping const mapping = ddc::detail::huge_page_registry().extract(&x);
+    EXPECT_EQ(mapping.size, 0);
+    EXPECT_EQ(mapping.status, ddc::HugePageStatus::NONE);
+}
+
+TEST(HugePageAllocatorTest, Chunk)
+{
+    DDomX const dom(DElemX(0), DVectX(1000));
+    ddc::Chunk chunk(dom, A());
+    ddc::parallel_fill(chunk, 2.);
+    EXPECT_EQ(chunk(dom.front()), 2.);
+    EXPECT_EQ(chunk(dom.back()), 2.);
+}
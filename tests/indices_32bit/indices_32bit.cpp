@@ -0,0 +1,101 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(INDICES_32BIT_CPP)
+{
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+    using DDomX = ddc::DiscreteDomain<DDimX>;
+
+    struct DDimY
+    {
+    };
+
+    using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+    using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+    using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+    static DDomX constexpr dom_x(DElemX(3), DVectX(11));
+
+    static DDomXY constexpr dom_x_y(DElemXY(3, 5), DVectXY(11, 7));
+
+} // namespace )
+
+TEST(Indices32Bit, Types)
+{
+    EXPECT_TRUE((std::is_same_v<ddc::DiscreteElementType, std::uint32_t>));
+    EXPECT_TRUE((std::is_same_v<ddc::DiscreteVectorElement, std::int32_t>));
+    EXPECT_TRUE((std::is_same_v<
+                 ddc::Chunk<int, DDomXY>::extents_type::index_type,
+                 ddc::DiscreteElementType>));
+}
+
+void TestIndices32BitParallelForEach1D()
+{
+    ddc::Chunk<int, DDomX, ddc::DeviceAllocator<int>> chunk(dom_x);
+    auto const span = chunk.span_view();
+    ddc::parallel_for_each(
+            dom_x,
+            KOKKOS_LAMBDA(DElemX const ix) { span(ix) = ddc::uid<DDimX>(ix); });
+    auto const host = ddc::create_mirror_view_and_copy(span);
+    ddc::for_each(dom_x, [&](DElemX const ix) {
+        EXPECT_EQ(host(ix), static_cast<int>(ddc::uid<DDimX>(ix)));
+    });
+}
+
+TEST(Indices32Bit, ParallelForEach1D)
+{
+    TestIndices32BitParallelForEach1D();
+}
+
+void TestIndices32BitParallelForEach2D()
+{
+    ddc::Chunk<int, DDomXY, ddc::DeviceAllocator<int>> chunk(dom_x_y);
+    auto const span = chunk.span_view();
+    ddc::parallel_for_each(
+            dom_x_y,
+            KOKKOS_LAMBDA(DElemXY const ixy) {
+                span(ixy) = 100 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy);
+            });
+    auto const host = ddc::create_mirror_view_and_copy(span);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        EXPECT_EQ(host(ixy), static_cast<int>(100 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy)));
+    });
+}
+
+TEST(Indices32Bit, ParallelForEach2D)
+{
+    TestIndices32BitParallelForEach2D();
+}
+
+void TestIndices32BitParallelTransformReduce()
+{
+    std::size_t const count = ddc::parallel_transform_reduce(
+            dom_x_y,
+            std::size_t(0),
+            ddc::reducer::sum<std::size_t>(),
+            KOKKOS_LAMBDA(DElemXY const ixy) -> std::size_t {
+                return ddc::uid<DDimX>(ixy) >= 8 ? 1 : 0;
+            });
+    // The elements 8 to 13 along DDimX
+    EXPECT_EQ(count, std::size_t(6 * 7));
+}
+
+TEST(Indices32Bit, ParallelTransformReduce)
+{
+    TestIndices32BitParallelTransformReduce();
+}
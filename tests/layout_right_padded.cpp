@@ -0,0 +1,140 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <type_traits>
+
+#include <experimental/mdspan>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(LAYOUT_RIGHT_PADDED_CPP)
+{
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+    using DDomX = ddc::DiscreteDomain<DDimX>;
+
+    struct DDimY
+    {
+    };
+    using DElemY = ddc::DiscreteElement<DDimY>;
+    using DVectY = ddc::DiscreteVector<DDimY>;
+    using DDomY = ddc::DiscreteDomain<DDimY>;
+
+    using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+    using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+    using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+    using PaddedLayout = ddc::layout_right_padded<8>;
+
+    template <class Datatype>
+    using PaddedChunkXY = ddc::Chunk<Datatype, DDomXY, ddc::HostAllocator<Datatype>, PaddedLayout>;
+
+    static DElemX constexpr lbound_x(3);
+    static DElemY constexpr lbound_y(7);
+    static DElemXY constexpr lbound_x_y(lbound_x, lbound_y);
+    static DVectXY constexpr nelems_x_y(DVectX(4), DVectY(5));
+    static DDomXY constexpr dom_x_y(lbound_x_y, nelems_x_y);
+
+} // namespace )
+
+TEST(LayoutRightPadded, Mapping)
+{
+    using extents_type = std::experimental::dextents<std::size_t, 3>;
+    PaddedLayout::mapping<extents_type> const mapping(extents_type(2, 3, 5));
+    EXPECT_EQ(mapping.stride(2), 1);
+    EXPECT_EQ(mapping.stride(1), 8);
+    EXPECT_EQ(mapping.stride(0), 24);
+    EXPECT_EQ(mapping.required_span_size(), 48);
+    EXPECT_EQ(mapping(1, 2, 3), 24 + 16 + 3);
+    EXPECT_FALSE(mapping.is_exhaustive());
+}
+
+TEST(LayoutRightPadded, AlignedLayout)
+{
+    EXPECT_TRUE((std::is_same_v<
+                 ddc::aligned_layout_right<double, 64>,
+                 ddc::layout_right_padded<8>>));
+    EXPECT_TRUE((std::is_same_v<
+                 ddc::aligned_layout_right<float, 64>,
+                 ddc::layout_right_padded<16>>));
+}
+
+TEST(LayoutRightPadded, Chunk)
+{
+    PaddedChunkXY<int> chunk(dom_x_y);
+    EXPECT_TRUE((std::is_same_v<decltype(chunk)::layout_type, PaddedLayout>));
+    EXPECT_EQ(chunk.stride<DDimY>(), 1);
+    EXPECT_EQ(chunk.stride<DDimX>(), 8);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        chunk(ixy) = 10 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy);
+    });
+    ddc::for_each(ddc::select<DDimX>(dom_x_y), [&](DElemX const ix) {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&chunk(ix, lbound_y)) % 32, 0);
+    });
+    auto const view = chunk.allocation_kokkos_view();
+    EXPECT_EQ(view.stride(0), 8);
+    EXPECT_EQ(view(1, 2), chunk(lbound_x_y + DVectXY(1, 2)));
+}
+
+TEST(LayoutRightPadded, Slicing)
+{
+    PaddedChunkXY<int> chunk(dom_x_y);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        chunk(ixy) = 10 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy);
+    });
+    DElemX const ix = ddc::select<DDimX>(lbound_x_y) + 2;
+    ddc::ChunkSpan const row = chunk[ix];
+    ddc::for_each(row.domain(), [&](DElemY const iy) { EXPECT_EQ(row(iy), chunk(ix, iy)); });
+    DElemY const iy = ddc::select<DDimY>(lbound_x_y) + 1;
+    ddc::ChunkSpan const column = chunk[iy];
+    EXPECT_EQ(column.stride<DDimX>(), 8);
+    ddc::for_each(column.domain(), [&](DElemX const jx) { EXPECT_EQ(column(jx), chunk(jx, iy)); });
+}
+
+TEST(LayoutRightPadded, Deepcopy)
+{
+    PaddedChunkXY<int> chunk(dom_x_y);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        chunk(ixy) = 10 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy);
+    });
+    PaddedChunkXY<int> chunk_padded_copy(dom_x_y);
+    ddc::parallel_deepcopy(chunk_padded_copy, chunk);
+    ddc::Chunk chunk_copy(dom_x_y, ddc::HostAllocator<int>());
+    ddc::parallel_deepcopy(chunk_copy, chunk);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        EXPECT_EQ(chunk_padded_copy(ixy), chunk(ixy));
+        EXPECT_EQ(chunk_copy(ixy), chunk(ixy));
+    });
+}
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(LAYOUT_RIGHT_PADDED_CPP)
+{
+    void TestLayoutRightPaddedMirror()
+    {
+        ddc::Chunk<int, DDomXY, ddc::DeviceAllocator<int>, PaddedLayout> chunk(dom_x_y);
+        ddc::ChunkSpan const chunk_span = chunk.span_view();
+        ddc::parallel_for_each(
+                dom_x_y,
+                KOKKOS_LAMBDA(DElemXY const ixy) {
+                    chunk_span(ixy) = 10 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy);
+                });
+        auto const chunk_host = ddc::create_mirror_view_and_copy(chunk_span);
+        EXPECT_TRUE((std::is_same_v<decltype(chunk_host)::layout_type, PaddedLayout>));
+        ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+            EXPECT_EQ(chunk_host(ixy), 10 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy));
+        });
+    }
+
+} // namespace )
+
+TEST(LayoutRightPadded, Mirror)
+{
+    TestLayoutRightPaddedMirror();
+}
@@ -0,0 +1,131 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <sstream>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(MAPPED_SAMPLING_CPP)
+{
+    struct DimX;
+
+    /// Points clustered near the origin
+    struct QuadraticMap
+    {
+        KOKKOS_FUNCTION double operator()(double const xi) const
+        {
+            return xi * xi;
+        }
+
+        KOKKOS_FUNCTION double inverse(double const x) const
+        {
+            return Kokkos::sqrt(x);
+        }
+
+        KOKKOS_FUNCTION double derivative(double const xi) const
+        {
+            return 2 * xi;
+        }
+    };
+
+    struct DDimX : ddc::MappedSampling<DimX, QuadraticMap>
+    {
+    };
+
+    struct DDimXDevice : ddc::MappedSampling<DimX, QuadraticMap>
+    {
+    };
+
+    struct DDimParticle
+    {
+    };
+
+} // namespace )
+
+TEST(MappedSamplingTest, Constructor)
+{
+    DDimX::Impl<DDimX, Kokkos::HostSpace> const ddim_x(QuadraticMap(), 0., 0.1);
+    EXPECT_EQ(ddim_x.front().uid(), 0);
+    EXPECT_DOUBLE_EQ(ddim_x.reference_coordinate(ddc::DiscreteElement<DDimX>(3)), 0.3);
+    EXPECT_DOUBLE_EQ(ddim_x.coordinate(ddc::DiscreteElement<DDimX>(3)), 0.09);
+    EXPECT_DOUBLE_EQ(ddim_x.jacobian(ddc::DiscreteElement<DDimX>(3)), 0.06);
+}
+
+TEST(MappedSamplingTest, Formatting)
+{
+    DDimX::Impl<DDimX, Kokkos::HostSpace> const ddim_x(QuadraticMap(), 0., 0.5);
+    std::stringstream oss;
+    oss << ddim_x;
+    EXPECT_EQ(oss.str(), "MappedSampling( reference_origin=0, reference_step=0.5 )");
+}
+
+TEST(MappedSamplingTest, FindCell)
+{
+    DDimX::Impl<DDimX, Kokkos::HostSpace> const ddim_x(QuadraticMap(), 0., 0.1);
+    ddc::DiscreteDomain<DDimX> const
+            cells(ddc::DiscreteElement<DDimX>(0), ddc::DiscreteVector<DDimX>(10));
+    for (ddc::DiscreteElement<DDimX> const ix : cells) {
+        EXPECT_EQ(ddim_x.find_cell(ddim_x.coordinate(ix)), ix);
+        double const middle = (ddim_x.coordinate(ix) + ddim_x.coordinate(ix + 1)) / 2;
+        EXPECT_EQ(ddim_x.find_cell(ddc::Coordinate<DimX>(middle)), ix);
+    }
+}
+
+TEST(MappedSamplingTest, InitGhosted)
+{
+    auto const [ddim_x, main_domain, ghosted_domain, pre_ghost, post_ghost]
+            = DDimX::init_ghosted<DDimX>(
+                    QuadraticMap(),
+                    1.,
+                    2.,
+                    ddc::DiscreteVector<DDimX>(11),
+                    ddc::DiscreteVector<DDimX>(2));
+    EXPECT_EQ(ghosted_domain.size(), 15);
+    EXPECT_EQ(pre_ghost.size(), 2);
+    EXPECT_EQ(post_ghost.size(), 2);
+    EXPECT_DOUBLE_EQ(ddim_x.coordinate(main_domain.front()), 1.);
+    EXPECT_DOUBLE_EQ(ddim_x.coordinate(main_domain.back()), 4.);
+    EXPECT_DOUBLE_EQ(ddim_x.coordinate(ghosted_domain.front()), 0.64);
+}
+
+void TestMappedSamplingDevice()
+{
+    ddc::DiscreteDomain<DDimXDevice> const domain_x = ddc::init_discrete_space<DDimXDevice>(
+            DDimXDevice::init<DDimXDevice>(
+                    QuadraticMap(),
+                    0.,
+                    1.,
+                    ddc::DiscreteVector<DDimXDevice>(101)));
+    EXPECT_DOUBLE_EQ(ddc::coordinate(domain_x.back()), 1.);
+    EXPECT_DOUBLE_EQ(ddc::rlength(domain_x), 1.);
+
+    ddc::DiscreteDomain<DDimParticle> const particles(
+            ddc::DiscreteElement<DDimParticle>(0),
+            ddc::DiscreteVector<DDimParticle>(1000));
+    using cell_type = ddc::DiscreteElement<DDimXDevice>;
+    ddc::Chunk cells_alloc(particles, ddc::DeviceAllocator<cell_type>());
+    ddc::ChunkSpan const cells = cells_alloc.span_view();
+    ddc::parallel_for_each(
+            particles,
+            KOKKOS_LAMBDA(ddc::DiscreteElement<DDimParticle> const ip) {
+                ddc::Coordinate<DimX> const x(ip.uid() / 1000.);
+                cells(ip) = ddc::find_cell(domain_x, x);
+            });
+    auto const cells_host = ddc::create_mirror_view_and_copy(cells_alloc.span_cview());
+    for (ddc::DiscreteElement<DDimParticle> const ip : particles) {
+        ddc::Coordinate<DimX> const x(ip.uid() / 1000.);
+        EXPECT_EQ(cells_host(ip), ddc::find_cell(domain_x, x));
+        EXPECT_LE(ddc::coordinate(cells_host(ip)), x);
+        EXPECT_LT(x, ddc::coordinate(cells_host(ip) + 1));
+    }
+}
+
+TEST(MappedSamplingTest, Device)
+{
+    TestMappedSamplingDevice();
+}
@@ -0,0 +1,133 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__)
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(MMAP_ALLOCATOR_CPP)
+{
+    using T = double;
+    using A = ddc::MmapAllocator<T>;
+    using U = char;
+    using B = std::allocator_traits<A>::rebind_alloc<U>;
+
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+
+    struct DDimY
+    {
+    };
+    using DElemY = ddc::DiscreteElement<DDimY>;
+    using DVectY = ddc::DiscreteVector<DDimY>;
+
+    using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+    using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+    using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+    static DDomXY constexpr dom_x_y(DElemXY(2, 7), DVectXY(10, 13));
+
+    std::string temporary_path(std::string const& name)
+    {
+        return (std::filesystem::temp_directory_path() / ("ddc_mmap_allocator_" + name)).string();
+    }
+
+    double value(DElemXY const ixy)
+    {
+        return 3. * ddc::uid<DDimX>(ixy) + 0.5 * ddc::uid<DDimY>(ixy);
+    }
+
+} // namespace )
+
+TEST(MmapAllocatorTest, Traits)
+{
+    using traits = std::allocator_traits<A>;
+    EXPECT_TRUE((std::is_same_v<traits::allocator_type, A>));
+    EXPECT_TRUE((std::is_same_v<traits::value_type, T>));
+    EXPECT_TRUE((std::is_same_v<traits::pointer, T*>));
+    EXPECT_TRUE((std::is_same_v<traits::rebind_alloc<U>, ddc::MmapAllocator<U>>));
+    EXPECT_TRUE((std::is_same_v<traits::is_always_equal, std::false_type>));
+    EXPECT_TRUE((std::is_constructible_v<A, B const&>));
+    EXPECT_TRUE((ddc::detail::is_extents_allocator_v<A, 2>));
+    EXPECT_FALSE((ddc::detail::is_extents_allocator_v<ddc::HostAllocator<T>, 2>));
+}
+
+TEST(MmapAllocatorTest, Equality)
+{
+    A const a("a");
+    B const b(a);
+    A const c("a");
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+}
+
+TEST(MmapAllocatorTest, CreateAndReopen)
+{
+    std::string const path = temporary_path("create_and_reopen");
+    {
+        A const allocator(path, ddc::MmapMode::CREATE);
+        ddc::Chunk chunk("mapped", dom_x_y, allocator);
+        ddc::for_each(dom_x_y, [&](DElemXY const ixy) { chunk(ixy) = value(ixy); });
+        allocator.sync();
+    }
+    EXPECT_EQ(
+            std::filesystem::file_size(path),
+            sizeof(ddc::MmapFileHeader) + dom_x_y.size() * sizeof(T));
+    {
+        ddc::Chunk chunk(dom_x_y, A(path, ddc::MmapMode::READ));
+        ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+            EXPECT_EQ(chunk(ixy), value(ixy));
+            // Private mapping, not written back
+            chunk(ixy) = 0.;
+        });
+    }
+    {
+        ddc::Chunk chunk(dom_x_y, A(path, ddc::MmapMode::READ_WRITE));
+        ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+            EXPECT_EQ(chunk(ixy), value(ixy));
+            chunk(ixy) = -value(ixy);
+        });
+    }
+    {
+        ddc::Chunk chunk(dom_x_y, A(path, ddc::MmapMode::READ));
+        ddc::for_each(dom_x_y, [&](DElemXY const ixy) { EXPECT_EQ(chunk(ixy), -value(ixy)); });
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(MmapAllocatorTest, InvalidFile)
+{
+    std::string const path = temporary_path("invalid_file");
+    {
+        ddc::Chunk chunk(dom_x_y, A(path, ddc::MmapMode::CREATE));
+    }
+    DDomXY const other_dom(dom_x_y.front(), DVectXY(10, 12));
+    EXPECT_THROW(
+            { ddc::Chunk const chunk(other_dom, A(path, ddc::MmapMode::READ)); },
+            std::runtime_error);
+    ddc::MmapAllocator<float> const float_allocator(path, ddc::MmapMode::READ);
+    EXPECT_THROW({ ddc::Chunk const chunk(dom_x_y, float_allocator); }, std::runtime_error);
+    // Same number of elements in another shape
+    DDomXY const transposed_dom(dom_x_y.front(), DVectXY(13, 10));
+    EXPECT_THROW(
+            { ddc::Chunk const chunk(transposed_dom, A(path, ddc::MmapMode::READ)); },
+            std::runtime_error);
+    std::filesystem::remove(path);
+    EXPECT_THROW(
+            { ddc::Chunk const chunk(dom_x_y, A(path, ddc::MmapMode::READ)); },
+            std::runtime_error);
+}
+
+#endif
@@ -0,0 +1,151 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(MULTI_CHUNK_CPP)
+{
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+
+    struct DDimY
+    {
+    };
+    using DElemY = ddc::DiscreteElement<DDimY>;
+    using DVectY = ddc::DiscreteVector<DDimY>;
+
+    using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+    using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+    using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+    struct Vx
+    {
+    };
+    struct Vy
+    {
+    };
+    struct Vz
+    {
+    };
+    using Velocity = ddc::Components<Vx, Vy, Vz>;
+
+    static DDomXY constexpr dom_x_y(DElemXY(2, 5), DVectXY(4, 7));
+
+    template <class LayoutPolicy>
+    using VelocityField
+            = ddc::MultiChunk<Velocity, double, DDomXY, ddc::HostAllocator<double>, LayoutPolicy>;
+
+    template <class MultiChunkType>
+    void fill(MultiChunkType& field)
+    {
+        ddc::for_each(field.domain(), [&](DElemXY const ixy) {
+            double const x = ddc::uid<DDimX>(ixy);
+            double const y = ddc::uid<DDimY>(ixy);
+            field.template at<Vx>(ixy) = x + y;
+            field.template at<Vy>(ixy) = x - y;
+            field.template at<Vz>(ixy) = x * y;
+        });
+    }
+
+} // namespace )
+
+TEST(MultiChunkTest, Components)
+{
+    EXPECT_EQ(Velocity::size(), 3);
+    EXPECT_EQ(VelocityField<ddc::layout_soa>::nb_components(), 3);
+    EXPECT_EQ(VelocityField<ddc::layout_soa>::component<Vy>().uid(), 1);
+}
+
+TEST(MultiChunkTest, SoAStrides)
+{
+    VelocityField<ddc::layout_soa> const field("velocity", dom_x_y);
+    EXPECT_EQ(field.label(), std::string_view("velocity"));
+    EXPECT_EQ(field.domain(), dom_x_y);
+    auto const vy = field.get<Vy>();
+    EXPECT_EQ(vy.domain(), dom_x_y);
+    EXPECT_EQ(vy.stride<DDimY>(), 1);
+    EXPECT_EQ(vy.stride<DDimX>(), 7);
+    EXPECT_EQ(
+            vy.data_handle() - field.get<Vx>().data_handle(),
+            static_cast<std::ptrdiff_t>(dom_x_y.size()));
+}
+
+TEST(MultiChunkTest, AoSoAStrides)
+{
+    // The components of each row in y are stored one after the other
+    VelocityField<ddc::layout_aosoa<1>> const field(dom_x_y);
+    auto const vy = field.get<Vy>();
+    EXPECT_EQ(vy.stride<DDimY>(), 1);
+    EXPECT_EQ(vy.stride<DDimX>(), 3 * 7);
+    EXPECT_EQ(vy.data_handle() - field.get<Vx>().data_handle(), 7);
+}
+
+TEST(MultiChunkTest, AoSStrides)
+{
+    VelocityField<ddc::layout_aosoa<2>> const field(dom_x_y);
+    auto const vy = field.get<Vy>();
+    EXPECT_EQ(vy.stride<DDimY>(), 3);
+    EXPECT_EQ(vy.stride<DDimX>(), 3 * 7);
+    EXPECT_EQ(vy.data_handle() - field.get<Vx>().data_handle(), 1);
+}
+
+TEST(MultiChunkTest, ComponentAccess)
+{
+    VelocityField<ddc::layout_aosoa<1>> field(dom_x_y);
+    fill(field);
+    auto const vz = field.get<Vz>();
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        EXPECT_EQ(vz(ixy), ddc::uid<DDimX>(ixy) * ddc::uid<DDimY>(ixy));
+    });
+    ddc::parallel_fill(field.get<Vx>(), 1.);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        EXPECT_EQ(field.at<Vx>(ixy), 1.);
+        EXPECT_EQ(field.at<Vz>(ixy), vz(ixy));
+    });
+}
+
+TEST(MultiChunkTest, FillAllComponents)
+{
+    // layout_aosoa has no Kokkos counterpart, the chunk is filled element by element
+    VelocityField<ddc::layout_aosoa<1>> field(dom_x_y);
+    ddc::parallel_fill(field.span_view(), 2.);
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        EXPECT_EQ(field.at<Vx>(ixy), 2.);
+        EXPECT_EQ(field.at<Vy>(ixy), 2.);
+        EXPECT_EQ(field.at<Vz>(ixy), 2.);
+    });
+}
+
+TEST(MultiChunkTest, DeepcopyBetweenLayouts)
+{
+    VelocityField<ddc::layout_soa> soa(dom_x_y);
+    fill(soa);
+    VelocityField<ddc::layout_aosoa<1>> aosoa(dom_x_y);
+    ddc::parallel_deepcopy(aosoa.span_view(), soa.span_cview());
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        EXPECT_EQ(aosoa.at<Vx>(ixy), soa.at<Vx>(ixy));
+        EXPECT_EQ(aosoa.at<Vy>(ixy), soa.at<Vy>(ixy));
+        EXPECT_EQ(aosoa.at<Vz>(ixy), soa.at<Vz>(ixy));
+    });
+    VelocityField<ddc::layout_aosoa<2>> aos(dom_x_y);
+    Kokkos::DefaultHostExecutionSpace const host_space;
+    ddc::parallel_deepcopy(host_space, aos.span_view(), aosoa.span_cview());
+    host_space.fence();
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        EXPECT_EQ(aos.at<Vx>(ixy), soa.at<Vx>(ixy));
+        EXPECT_EQ(aos.at<Vy>(ixy), soa.at<Vy>(ixy));
+        EXPECT_EQ(aos.at<Vz>(ixy), soa.at<Vz>(ixy));
+    });
+}
@@ -0,0 +1,135 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(MULTI_PATCH_CPP)
+{
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+    using DDomX = ddc::DiscreteDomain<DDimX>;
+
+    struct DDimY
+    {
+    };
+
+    using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+    using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+    using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+    /// Two patches of different sizes, overlapping in the index space
+    ddc::MultiPatchDomain<DDimX, DDimY> make_patches_xy()
+    {
+        return ddc::MultiPatchDomain<DDimX, DDimY>(std::vector<DDomXY> {
+                DDomXY(DElemXY(0, 0), DVectXY(3, 4)),
+                DDomXY(DElemXY(2, 1), DVectXY(5, 2))});
+    }
+
+    KOKKOS_FUNCTION double value(std::size_t const p, DElemXY const ixy)
+    {
+        return 100. * p + 10. * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy);
+    }
+
+} // namespace )
+
+TEST(MultiPatchDomain, Constructor)
+{
+    ddc::MultiPatchDomain<DDimX, DDimY> const domain = make_patches_xy();
+    EXPECT_EQ(domain.nb_patches(), 2);
+    EXPECT_EQ(domain.size(), 22);
+    EXPECT_EQ(domain.offset(0), 0);
+    EXPECT_EQ(domain.offset(1), 12);
+    EXPECT_EQ(domain.patch(1), DDomXY(DElemXY(2, 1), DVectXY(5, 2)));
+    EXPECT_THROW(ddc::MultiPatchDomain<DDimX>(std::vector<DDomX>()), std::invalid_argument);
+}
+
+TEST(MultiPatchChunk, PatchAccess)
+{
+    ddc::MultiPatchDomain<DDimX, DDimY> const domain = make_patches_xy();
+    ddc::MultiPatchChunk<double, ddc::MultiPatchDomain<DDimX, DDimY>> chunk(domain);
+    for (std::size_t p = 0; p < domain.nb_patches(); ++p) {
+        ddc::ChunkSpan const patch = chunk.patch(p);
+        EXPECT_EQ(patch.domain(), domain.patch(p));
+        ddc::for_each(patch.domain(), [&](DElemXY const ixy) { patch(ixy) = value(p, ixy); });
+    }
+    auto const span = chunk.span_cview();
+    EXPECT_EQ(span.nb_patches(), 2);
+    for (std::size_t p = 0; p < domain.nb_patches(); ++p) {
+        ddc::for_each(domain.patch(p), [&](DElemXY const ixy) {
+            EXPECT_EQ(span(p, ixy), value(p, ixy));
+            EXPECT_EQ(span[p](ixy), value(p, ixy));
+        });
+    }
+}
+
+void TestMultiPatchParallelForEach()
+{
+    ddc::MultiPatchDomain<DDimX, DDimY> const domain = make_patches_xy();
+    ddc::MultiPatchChunk<double, ddc::MultiPatchDomain<DDimX, DDimY>, ddc::DeviceAllocator<double>>
+            chunk(domain);
+    auto const span = chunk.span_view();
+    ddc::parallel_for_each(
+            domain,
+            KOKKOS_LAMBDA(std::size_t const p, DElemXY const ixy) {
+                span(p, ixy) = value(p, ixy);
+            });
+    for (std::size_t p = 0; p < domain.nb_patches(); ++p) {
+        auto const patch_host = ddc::create_mirror_view_and_copy(chunk.patch(p));
+        ddc::for_each(patch_host.domain(), [&](DElemXY const ixy) {
+            EXPECT_EQ(patch_host(ixy), value(p, ixy));
+        });
+    }
+}
+
+TEST(MultiPatchChunk, ParallelForEach)
+{
+    TestMultiPatchParallelForEach();
+}
+
+void TestMultiPatchHaloExchange()
+{
+    // Two 1D patches, each with a ghost point facing the other one
+    DDomX const patch0(DElemX(0), DVectX(6));
+    DDomX const patch1(DElemX(10), DVectX(6));
+    ddc::MultiPatchDomain<DDimX> const domain(std::vector<DDomX> {patch0, patch1});
+    std::vector<ddc::PatchInterface<DDimX>> const interfaces {
+            {1, DDomX(DElemX(11), DVectX(1)), 0, patch0.take_last(DVectX(1))},
+            {0, DDomX(DElemX(4), DVectX(1)), 1, patch1.take_first(DVectX(1))}};
+    ddc::MultiPatchHaloExchange<DDimX> const exchange(domain, interfaces);
+    EXPECT_EQ(exchange.nb_interfaces(), 2);
+    EXPECT_EQ(exchange.size(), 2);
+
+    ddc::MultiPatchChunk<double, ddc::MultiPatchDomain<DDimX>, ddc::DeviceAllocator<double>> chunk(
+            domain);
+    auto const span = chunk.span_view();
+    ddc::parallel_for_each(
+            domain,
+            KOKKOS_LAMBDA(std::size_t const p, DElemX const ix) {
+                span(p, ix) = 100. * p + ddc::uid<DDimX>(ix);
+            });
+    exchange(span);
+
+    auto const patch0_host = ddc::create_mirror_view_and_copy(chunk.patch(0));
+    auto const patch1_host = ddc::create_mirror_view_and_copy(chunk.patch(1));
+    EXPECT_EQ(patch0_host(DElemX(5)), 111.);
+    EXPECT_EQ(patch1_host(DElemX(10)), 4.);
+    EXPECT_EQ(patch0_host(DElemX(4)), 4.);
+    EXPECT_EQ(patch1_host(DElemX(11)), 111.);
+}
+
+TEST(MultiPatchHaloExchange, Exchange)
+{
+    TestMultiPatchHaloExchange();
+}
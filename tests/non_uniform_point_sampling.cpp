@@ -3,7 +3,9 @@
 // SPDX-License-Identifier: MIT
 
 #include <array>
+#include <cstddef>
 #include <sstream>
+#include <stdexcept>
 #include <vector>
 
 #include <ddc/ddc.hpp>
@@ -37,6 +39,27 @@ namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(NON_UNIFORM_POINT_SAMPLING_
     {
     };
 
+    struct DDimGenerated : ddc::NonUniformPointSampling<DimX>
+    {
+    };
+
+    /// Points clustered near the origin
+    struct QuadraticGenerator
+    {
+        KOKKOS_FUNCTION double operator()(std::size_t const i) const
+        {
+            return 0.01 * i * i;
+        }
+    };
+
+    struct ConstantGenerator
+    {
+        KOKKOS_FUNCTION double operator()(std::size_t) const
+        {
+            return 1.;
+        }
+    };
+
     static std::array<double, 4> const array_points_x VALUES_X;
     static std::vector<double> const vector_points_x VALUES_X;
 
@@ -99,3 +122,74 @@ TEST(NonUniformPointSampling, Coordinate)
     EXPECT_EQ(ddc::coordinate(point_iy), point_ry);
     EXPECT_EQ(ddc::coordinate(point_ixy), point_rxy);
 }
+
+TEST(NonUniformPointSamplingTest, Metrics)
+{
+    DDimX::Impl<DDimX, Kokkos::HostSpace> ddim_x(
+            {ddc::Coordinate<DimX>(0.), ddc::Coordinate<DimX>(0.1), ddc::Coordinate<DimX>(0.4)});
+    ddc::DiscreteElement<DDimX> const ix(1);
+    EXPECT_FALSE(ddim_x.has_metrics());
+    EXPECT_DOUBLE_EQ(ddim_x.distance_at_left(ix), 0.1);
+    EXPECT_DOUBLE_EQ(ddim_x.distance_at_right(ix), 0.3);
+    EXPECT_DOUBLE_EQ(ddim_x.midpoint_spacing(ix), 0.2);
+    ddim_x.compute_metrics();
+    EXPECT_TRUE(ddim_x.has_metrics());
+    EXPECT_EQ(ddim_x.cell_widths().size(), 2);
+    EXPECT_EQ(ddim_x.midpoint_spacings().size(), 3);
+    EXPECT_DOUBLE_EQ(ddim_x.cell_widths()(0), 0.1);
+    EXPECT_DOUBLE_EQ(ddim_x.cell_widths()(1), 0.3);
+    EXPECT_DOUBLE_EQ(ddim_x.distance_at_left(ix), 0.1);
+    EXPECT_DOUBLE_EQ(ddim_x.distance_at_right(ix), 0.3);
+    EXPECT_DOUBLE_EQ(ddim_x.inv_distance_at_left(ix), 10.);
+    EXPECT_DOUBLE_EQ(ddim_x.inv_distance_at_right(ix), 1. / 0.3);
+    EXPECT_DOUBLE_EQ(ddim_x.midpoint_spacing(ix), 0.2);
+    // The boundary points only count their inner half cell
+    EXPECT_DOUBLE_EQ(ddim_x.midpoint_spacings()(0), 0.05);
+    EXPECT_DOUBLE_EQ(ddim_x.midpoint_spacings()(2), 0.15);
+}
+
+TEST(NonUniformPointSamplingTest, KokkosViewConstructor)
+{
+    Kokkos::View<ddc::Coordinate<DimX>*, Kokkos::HostSpace> points("points", 4);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        points(i) = ddc::Coordinate<DimX>(vector_points_x[i]);
+    }
+    DDimX::Impl<DDimX, Kokkos::HostSpace> const ddim_x(points);
+    EXPECT_EQ(ddim_x.size(), 4);
+    EXPECT_EQ(ddim_x.coordinate(point_ix), point_rx);
+}
+
+TEST(NonUniformPointSamplingTest, GeneratorConstructor)
+{
+    DDimX::Impl<DDimX, Kokkos::HostSpace> const
+            ddim_x(Kokkos::DefaultExecutionSpace(), QuadraticGenerator(), 100);
+    EXPECT_EQ(ddim_x.size(), 100);
+    EXPECT_DOUBLE_EQ(ddim_x.coordinate(ddc::DiscreteElement<DDimX>(10)), 1.);
+    EXPECT_EQ(ddim_x.find_cell(ddc::Coordinate<DimX>(1.1)), ddc::DiscreteElement<DDimX>(10));
+    // The buckets built on the device agree with a linear search
+    for (std::size_t k = 0; k <= 200; ++k) {
+        ddc::Coordinate<DimX> const x(-1. + k * 100. / 200.);
+        std::size_t cell = 0;
+        while (cell + 2 < ddim_x.size()
+               && !(x < ddim_x.coordinate(ddc::DiscreteElement<DDimX>(cell + 1)))) {
+            ++cell;
+        }
+        EXPECT_EQ(ddim_x.find_cell(x), ddc::DiscreteElement<DDimX>(cell));
+    }
+    EXPECT_THROW(
+            (DDimX::Impl<DDimX, Kokkos::HostSpace>(
+                    Kokkos::DefaultExecutionSpace(),
+                    ConstantGenerator(),
+                    10)),
+            std::runtime_error);
+}
+
+TEST(NonUniformPointSamplingTest, InitGenerator)
+{
+    ddc::DiscreteDomain<DDimGenerated> const domain
+            = ddc::init_discrete_space<DDimGenerated>(DDimGenerated::init<DDimGenerated>(
+                    QuadraticGenerator(),
+                    ddc::DiscreteVector<DDimGenerated>(50)));
+    EXPECT_EQ(domain.size(), 50);
+    EXPECT_DOUBLE_EQ(ddc::coordinate(domain.back()), 0.01 * 49 * 49);
+}
@@ -73,3 +73,29 @@ TEST(ParallelDeepcopy, TwoDimensionsWithExecutionSpace)
     EXPECT_EQ(chk_copy(dom.front() + DVectXY(0, 1)), 3);
     EXPECT_EQ(chk_copy(dom.front() + DVectXY(1, 1)), 4);
 }
+
+TEST(ParallelDeepcopy, Transpose)
+{
+    DDomXY const dom(lbound_x_y, DVectXY(37, 45));
+    ddc::Chunk chk(dom, ddc::HostAllocator<int>());
+    ddc::for_each(dom, [&](DElemXY const ixy) {
+        chk(ixy) = 100 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy);
+    });
+    ddc::Chunk chk_copy(ddc::select<DDimY, DDimX>(dom), ddc::HostAllocator<int>());
+    ddc::parallel_deepcopy(chk_copy, chk);
+    ddc::for_each(dom, [&](DElemXY const ixy) { EXPECT_EQ(chk_copy(ixy), chk(ixy)); });
+}
+
+TEST(ParallelDeepcopy, TransposeWithExecutionSpace)
+{
+    DDomXY const dom(lbound_x_y, DVectXY(37, 45));
+    ddc::Chunk chk(ddc::select<DDimY, DDimX>(dom), ddc::HostAllocator<int>());
+    ddc::for_each(dom, [&](DElemXY const ixy) {
+        chk(ixy) = 100 * ddc::uid<DDimX>(ixy) + ddc::uid<DDimY>(ixy);
+    });
+    ddc::Chunk chk_copy(dom, ddc::HostAllocator<int>());
+    Kokkos::DefaultHostExecutionSpace const exec_space;
+    ddc::parallel_deepcopy(exec_space, chk_copy, chk.span_cview());
+    exec_space.fence();
+    ddc::for_each(dom, [&](DElemXY const ixy) { EXPECT_EQ(chk_copy(ixy), chk(ixy)); });
+}
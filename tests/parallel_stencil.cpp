@@ -0,0 +1,204 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(PARALLEL_STENCIL_CPP)
+{
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+    using DDomX = ddc::DiscreteDomain<DDimX>;
+
+    struct DDimY
+    {
+    };
+    using DElemY = ddc::DiscreteElement<DDimY>;
+    using DVectY = ddc::DiscreteVector<DDimY>;
+    using DDomY = ddc::DiscreteDomain<DDimY>;
+
+    using DElemXY = ddc::DiscreteElement<DDimX, DDimY>;
+    using DVectXY = ddc::DiscreteVector<DDimX, DDimY>;
+    using DDomXY = ddc::DiscreteDomain<DDimX, DDimY>;
+
+    static DElemXY constexpr lbound_x_y(DElemX(3), DElemY(5));
+    static DVectXY constexpr nelems_x_y(DVectX(19), DVectY(45));
+    static DDomXY constexpr dom_x_y(lbound_x_y, nelems_x_y);
+
+    KOKKOS_FUNCTION double value(DElemXY const ixy)
+    {
+        return 1.5 * ddc::uid<DDimX>(ixy) + 0.25 * ddc::uid<DDimY>(ixy) * ddc::uid<DDimY>(ixy);
+    }
+
+} // namespace )
+
+TEST(ParallelStencilParallelHost, OneDimensionRadiusTwo)
+{
+    DDomX const dom(DElemX(4), DVectX(70));
+    DVectX const radius(2);
+    DDomX const ghosted_dom(dom.front() - radius, dom.extents() + 2 * radius);
+    ddc::Chunk in(ghosted_dom, ddc::HostAllocator<int>());
+    ddc::for_each(ghosted_dom, [&](DElemX const ix) {
+        in(ix) = static_cast<int>(ix.uid() * ix.uid());
+    });
+    ddc::Chunk out(dom, ddc::HostAllocator<int>());
+    ddc::parallel_stencil(
+            Kokkos::DefaultHostExecutionSpace(),
+            dom,
+            radius,
+            in,
+            out,
+            [](DElemX, auto const& nbr) {
+                return nbr(DVectX(-2)) + nbr(DVectX(-1)) + nbr() + nbr(DVectX(1))
+                       + nbr(DVectX(2));
+            });
+    Kokkos::DefaultHostExecutionSpace().fence();
+    ddc::for_each(dom, [&](DElemX const ix) {
+        EXPECT_EQ(out(ix), in(ix - 2) + in(ix - 1) + in(ix) + in(ix + 1) + in(ix + 2));
+    });
+}
+
+TEST(ParallelStencilParallelHost, TwoDimensions)
+{
+    DVectXY const radius(1, 1);
+    DDomXY const ghosted_dom(dom_x_y.front() - radius, dom_x_y.extents() + 2 * radius);
+    ddc::Chunk in(ghosted_dom, ddc::HostAllocator<double>());
+    ddc::for_each(ghosted_dom, [&](DElemXY const ixy) { in(ixy) = value(ixy); });
+    ddc::Chunk out(dom_x_y, ddc::HostAllocator<double>());
+    ddc::parallel_stencil(
+            Kokkos::DefaultHostExecutionSpace(),
+            dom_x_y,
+            radius,
+            in,
+            out,
+            [](DElemXY, auto const& nbr) {
+                return nbr(DVectX(1)) + nbr(DVectX(-1)) + nbr(DVectY(1)) + nbr(DVectY(-1))
+                       - 4 * nbr() + nbr(DVectXY(1, 1));
+            });
+    Kokkos::DefaultHostExecutionSpace().fence();
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+        DElemX const ix = ddc::select<DDimX>(ixy);
+        DElemY const iy = ddc::select<DDimY>(ixy);
+        EXPECT_DOUBLE_EQ(
+                out(ixy),
+                in(ix + 1, iy) + in(ix - 1, iy) + in(ix, iy + 1) + in(ix, iy - 1) - 4 * in(ixy)
+                        + in(ix + 1, iy + 1));
+    });
+}
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(PARALLEL_STENCIL_CPP)
+{
+    void TestParallelStencilParallelDeviceTwoDimensions()
+    {
+        DVectXY const radius(1, 1);
+        DDomXY const ghosted_dom(dom_x_y.front() - radius, dom_x_y.extents() + 2 * radius);
+        ddc::Chunk in_alloc(ghosted_dom, ddc::DeviceAllocator<double>());
+        ddc::ChunkSpan const in = in_alloc.span_view();
+        ddc::parallel_for_each(
+                ghosted_dom,
+                KOKKOS_LAMBDA(DElemXY const ixy) { in(ixy) = value(ixy); });
+        ddc::Chunk out_alloc(dom_x_y, ddc::DeviceAllocator<double>());
+        ddc::parallel_stencil(
+                dom_x_y,
+                radius,
+                in,
+                out_alloc,
+                KOKKOS_LAMBDA(
+                        DElemXY,
+                        ddc::StencilAccessor<double, DDimX, DDimY> const& nbr) {
+                    return nbr(DVectX(1)) + nbr(DVectX(-1)) + nbr(DVectY(1)) + nbr(DVectY(-1))
+                           - 4 * nbr();
+                });
+        auto const out = ddc::create_mirror_view_and_copy(out_alloc.span_cview());
+        ddc::for_each(dom_x_y, [&](DElemXY const ixy) {
+            DElemX const ix = ddc::select<DDimX>(ixy);
+            DElemY const iy = ddc::select<DDimY>(ixy);
+            EXPECT_DOUBLE_EQ(
+                    out(ixy),
+                    value(DElemXY(ix + 1, iy)) + value(DElemXY(ix - 1, iy))
+                            + value(DElemXY(ix, iy + 1)) + value(DElemXY(ix, iy - 1))
+                            - 4 * value(ixy));
+        });
+    }
+
+} // namespace )
+
+TEST(ParallelStencilParallelDevice, TwoDimensions)
+{
+    TestParallelStencilParallelDeviceTwoDimensions();
+}
+
+TEST(ParallelStencilStepsParallelHost, TwoDimensionsThreeSteps)
+{
+    DVectXY const radius(1, 1);
+    std::size_t const nb_steps = 3;
+    auto const diffusion = [](DElemXY, auto const& nbr) {
+        return nbr() + 0.1 * (nbr(DVectX(1)) + nbr(DVectX(-1)) + nbr(DVectY(1)) + nbr(DVectY(-1)));
+    };
+    DDomXY const ghosted_dom(dom_x_y.front() - 3 * radius, dom_x_y.extents() + 6 * radius);
+    ddc::Chunk in(ghosted_dom, ddc::HostAllocator<double>());
+    ddc::for_each(ghosted_dom, [&](DElemXY const ixy) { in(ixy) = value(ixy); });
+
+    // Reference: one step at a time on domains shrinking by the radius
+    DDomXY const dom_1(dom_x_y.front() - 2 * radius, dom_x_y.extents() + 4 * radius);
+    DDomXY const dom_2(dom_x_y.front() - radius, dom_x_y.extents() + 2 * radius);
+    ddc::Chunk ref_1(dom_1, ddc::HostAllocator<double>());
+    ddc::Chunk ref_2(dom_2, ddc::HostAllocator<double>());
+    ddc::Chunk ref(dom_x_y, ddc::HostAllocator<double>());
+    Kokkos::DefaultHostExecutionSpace const exec;
+    ddc::parallel_stencil(exec, dom_1, radius, in, ref_1, diffusion);
+    ddc::parallel_stencil(exec, dom_2, radius, ref_1, ref_2, diffusion);
+    ddc::parallel_stencil(exec, dom_x_y, radius, ref_2, ref, diffusion);
+
+    ddc::Chunk out(dom_x_y, ddc::HostAllocator<double>());
+    ddc::parallel_stencil_steps(exec, dom_x_y, radius, nb_steps, in, out, diffusion);
+    exec.fence();
+    ddc::for_each(dom_x_y, [&](DElemXY const ixy) { EXPECT_DOUBLE_EQ(out(ixy), ref(ixy)); });
+}
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(PARALLEL_STENCIL_CPP)
+{
+    void TestParallelStencilStepsParallelDeviceOneDimension()
+    {
+        DDomX const dom(DElemX(4), DVectX(100));
+        DVectX const radius(1);
+        std::size_t const nb_steps = 4;
+        DDomX const ghosted_dom(dom.front() - 4 * radius, dom.extents() + 8 * radius);
+        ddc::Chunk in_alloc(ghosted_dom, ddc::DeviceAllocator<int>());
+        ddc::ChunkSpan const in = in_alloc.span_view();
+        ddc::parallel_for_each(
+                ghosted_dom,
+                KOKKOS_LAMBDA(DElemX const ix) { in(ix) = static_cast<int>(ix.uid() % 7); });
+        ddc::Chunk out_alloc(dom, ddc::DeviceAllocator<int>());
+        ddc::parallel_stencil_steps(
+                dom,
+                radius,
+                nb_steps,
+                in,
+                out_alloc,
+                KOKKOS_LAMBDA(DElemX, ddc::StencilAccessor<int, DDimX> const& nbr) {
+                    return nbr(DVectX(-1)) + nbr() + nbr(DVectX(1));
+                });
+        auto const out = ddc::create_mirror_view_and_copy(out_alloc.span_cview());
+        // Four steps of a three points sum is a weighted sum of nine points
+        int const weights[] = {1, 4, 10, 16, 19, 16, 10, 4, 1};
+        ddc::for_each(dom, [&](DElemX const ix) {
+            int expected = 0;
+            for (int k = 0; k < 9; ++k) {
+                expected += weights[k] * static_cast<int>((ix.uid() + k - 4) % 7);
+            }
+            EXPECT_EQ(out(ix), expected);
+        });
+    }
+
+} // namespace )
+
+TEST(ParallelStencilStepsParallelDevice, OneDimensionFourSteps)
+{
+    TestParallelStencilStepsParallelDeviceOneDimension();
+}
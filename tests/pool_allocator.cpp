@@ -0,0 +1,87 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(POOL_ALLOCATOR_CPP)
+{
+    using T = double;
+    using A = ddc::PoolAllocator<T, Kokkos::HostSpace>;
+    using U = char;
+    using B = std::allocator_traits<A>::rebind_alloc<U>;
+
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+    using DDomX = ddc::DiscreteDomain<DDimX>;
+
+} // namespace )
+
+TEST(PoolAllocatorTest, SizeClass)
+{
+    EXPECT_EQ(ddc::detail::pool_size_class(1), 256);
+    EXPECT_EQ(ddc::detail::pool_size_class(256), 256);
+    EXPECT_EQ(ddc::detail::pool_size_class(257), 320);
+    EXPECT_EQ(ddc::detail::pool_size_class(512), 512);
+    EXPECT_EQ(ddc::detail::pool_size_class(1000), 1024);
+}
+
+TEST(PoolAllocatorTest, Traits)
+{
+    using traits = std::allocator_traits<A>;
+    EXPECT_TRUE((std::is_same_v<traits::allocator_type, A>));
+    EXPECT_TRUE((std::is_same_v<traits::value_type, T>));
+    EXPECT_TRUE((std::is_same_v<traits::pointer, T*>));
+    EXPECT_TRUE(
+            (std::is_same_v<traits::rebind_alloc<U>, ddc::PoolAllocator<U, Kokkos::HostSpace>>));
+    EXPECT_TRUE((std::is_same_v<traits::is_always_equal, std::false_type>));
+}
+
+TEST(PoolAllocatorTest, RebindCopyConstructor)
+{
+    EXPECT_TRUE((std::is_constructible_v<A, B const&>));
+}
+
+TEST(PoolAllocatorTest, Equality)
+{
+    auto const pool = std::make_shared<ddc::MemoryPool<Kokkos::HostSpace>>();
+    A const a(pool);
+    B const b(a);
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, A());
+}
+
+TEST(PoolAllocatorTest, ReuseBlocks)
+{
+    auto const pool = std::make_shared<ddc::MemoryPool<Kokkos::HostSpace>>("test_pool");
+    DDomX const dom(DElemX(0), DVectX(100));
+    for (int i = 0; i < 5; ++i) {
+        ddc::Chunk chunk("tmp", dom, A(pool));
+        ddc::parallel_fill(chunk, 1.);
+        EXPECT_EQ(pool->used_bytes(), ddc::detail::pool_size_class(sizeof(T) * dom.size()));
+    }
+    EXPECT_EQ(pool->nb_allocations(), 5);
+    EXPECT_EQ(pool->nb_system_allocations(), 1);
+    EXPECT_EQ(pool->used_bytes(), 0);
+    EXPECT_EQ(pool->cached_bytes(), ddc::detail::pool_size_class(sizeof(T) * dom.size()));
+    pool->reset();
+    EXPECT_EQ(pool->cached_bytes(), 0);
+}
+
+TEST(PoolAllocatorTest, NoPool)
+{
+    DDomX const dom(DElemX(0), DVectX(10));
+    ddc::Chunk chunk("tmp", dom, A());
+    ddc::parallel_fill(chunk, 1.);
+    EXPECT_DOUBLE_EQ(chunk(dom.front()), 1.);
+}
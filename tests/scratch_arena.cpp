@@ -0,0 +1,94 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(SCRATCH_ARENA_CPP)
+{
+    using Arena = ddc::ScratchArena<Kokkos::HostSpace>;
+    using A = ddc::ArenaAllocator<double, Kokkos::HostSpace>;
+
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+    using DDomX = ddc::DiscreteDomain<DDimX>;
+
+} // namespace )
+
+TEST(ScratchArenaTest, Traits)
+{
+    using traits = std::allocator_traits<A>;
+    EXPECT_TRUE((std::is_same_v<traits::value_type, double>));
+    EXPECT_TRUE((std::is_same_v<
+                 traits::rebind_alloc<char>,
+                 ddc::ArenaAllocator<char, Kokkos::HostSpace>>));
+}
+
+TEST(ScratchArenaTest, Alignment)
+{
+    Arena arena(1024);
+    void* const p1 = arena.allocate(1);
+    void* const p2 = arena.allocate(1, 128);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p1) % Arena::default_alignment, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p2) % 128, 0);
+    EXPECT_THROW((void)arena.allocate(2048), std::runtime_error);
+}
+
+TEST(ScratchArenaTest, Scope)
+{
+    Arena arena(1024);
+    (void)arena.allocate(10);
+    std::size_t const marker = arena.marker();
+    {
+        Arena::Scope const scope(arena);
+        (void)arena.allocate(100);
+        EXPECT_GT(arena.used_bytes(), marker);
+    }
+    EXPECT_EQ(arena.marker(), marker);
+    arena.reset();
+    EXPECT_EQ(arena.used_bytes(), 0);
+    EXPECT_GE(arena.high_water_mark(), 110);
+}
+
+TEST(ScratchArenaTest, ScopeAfterOlderDeallocation)
+{
+    Arena arena(1024);
+    void* const p = arena.allocate(64);
+    {
+        Arena::Scope const scope(arena);
+        // Releases a block allocated before the scope
+        arena.deallocate(p, 64);
+        EXPECT_EQ(arena.used_bytes(), 0);
+    }
+    EXPECT_EQ(arena.used_bytes(), 0);
+    void* const q = arena.allocate(64);
+    EXPECT_EQ(q, p);
+    EXPECT_EQ(arena.used_bytes(), 64);
+}
+
+TEST(ScratchArenaTest, Chunk)
+{
+    Arena arena("arena", 1024 * sizeof(double));
+    DDomX const dom(DElemX(0), DVectX(10));
+    {
+        Arena::Scope const scope(arena);
+        ddc::Chunk chunk1("chunk1", dom, A(arena));
+        ddc::Chunk chunk2("chunk2", dom, A(arena));
+        ddc::parallel_fill(chunk1, 1.);
+        ddc::parallel_deepcopy(chunk2, chunk1);
+        EXPECT_DOUBLE_EQ(chunk2(dom.front()), 1.);
+        EXPECT_GE(arena.used_bytes(), 2 * dom.size() * sizeof(double));
+    }
+    EXPECT_EQ(arena.used_bytes(), 0);
+}
@@ -0,0 +1,173 @@
+// Copyright (C) The DDC development team, see COPYRIGHT.md file
+//
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <experimental/mdspan>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+namespace DDC_HIP_5_7_ANONYMOUS_NAMESPACE_WORKAROUND(STATIC_EXTENT_CPP)
+{
+    struct DDimX
+    {
+    };
+    using DElemX = ddc::DiscreteElement<DDimX>;
+    using DVectX = ddc::DiscreteVector<DDimX>;
+    using DDomX = ddc::DiscreteDomain<DDimX>;
+
+    struct DDimC
+    {
+    };
+    using DElemC = ddc::DiscreteElement<DDimC>;
+    using DVectC = ddc::DiscreteVector<DDimC>;
+    using DDomC = ddc::DiscreteDomain<DDimC>;
+
+    using DElemXC = ddc::DiscreteElement<DDimX, DDimC>;
+    using DDomXC = ddc::DiscreteDomain<DDimX, DDimC>;
+
+    static DElemX constexpr lbound_x(4);
+    static DVectX constexpr nelems_x(10);
+    static DDomX constexpr dom_x(lbound_x, nelems_x);
+
+    static DElemC constexpr lbound_c(1);
+    static DVectC constexpr nelems_c(3);
+    static DDomC constexpr dom_c(lbound_c, nelems_c);
+
+    static DDomXC constexpr dom_x_c(dom_x, dom_c);
+
+    struct Vx;
+    struct Vy;
+    struct Vz;
+
+} // namespace )
+
+namespace ddc {
+
+template <>
+inline constexpr std::size_t static_extent_v<DDimC> = 3;
+
+} // namespace ddc
+
+TEST(StaticExtent, ChunkExtents)
+{
+    using chunk_type = ddc::Chunk<double, DDomXC>;
+    static_assert(chunk_type::rank() == 2);
+    static_assert(chunk_type::rank_dynamic() == 1);
+    static_assert(chunk_type::static_extent(0) == std::experimental::dynamic_extent);
+    static_assert(chunk_type::static_extent(1) == 3);
+    static_assert(chunk_type::span_type::static_extent(1) == 3);
+
+    chunk_type chunk(dom_x_c);
+    EXPECT_EQ(chunk.allocation_mdspan().extent(0), nelems_x.value());
+    EXPECT_EQ(chunk.allocation_mdspan().extent(1), nelems_c.value());
+    EXPECT_EQ(chunk.stride<DDimX>(), 3);
+    EXPECT_EQ(chunk.stride<DDimC>(), 1);
+}
+
+TEST(StaticExtent, Slicing)
+{
+    ddc::Chunk<double, DDomXC> chunk(dom_x_c);
+    ddc::for_each(dom_x_c, [&](DElemXC const ixc) {
+        chunk(ixc) = 10. * ddc::uid<DDimX>(ixc) + ddc::uid<DDimC>(ixc);
+    });
+
+    auto const chunk_c = chunk[lbound_x + 2];
+    static_assert(decltype(chunk_c)::static_extent(0) == 3);
+    for (DElemC const ic : dom_c) {
+        EXPECT_EQ(chunk_c(ic), chunk(lbound_x + 2, ic));
+    }
+
+    auto const chunk_x = chunk[lbound_c + 1];
+    static_assert(decltype(chunk_x)::static_extent(0) == std::experimental::dynamic_extent);
+    for (DElemX const ix : dom_x) {
+        EXPECT_EQ(chunk_x(ix), chunk(ix, lbound_c + 1));
+    }
+
+    DDomX const subdom_x(lbound_x + 1, DVectX(4));
+    auto const subchunk = chunk[subdom_x];
+    static_assert(decltype(subchunk)::static_extent(1) == 3);
+    ddc::for_each(subchunk.domain(), [&](DElemXC const ixc) {
+        EXPECT_EQ(subchunk(ixc), chunk(ixc));
+    });
+}
+
+TEST(StaticExtent, RestrictStaticDimension)
+{
+    ddc::Chunk<double, DDomXC> chunk(dom_x_c);
+    ddc::for_each(dom_x_c, [&](DElemXC const ixc) {
+        chunk(ixc) = 10. * ddc::uid<DDimX>(ixc) + ddc::uid<DDimC>(ixc);
+    });
+
+    DDomC const subdom_c(lbound_c + 1, DVectC(2));
+    auto const subchunk = chunk[subdom_c];
+    static_assert(decltype(subchunk)::static_extent(0) == std::experimental::dynamic_extent);
+    static_assert(decltype(subchunk)::static_extent(1) == std::experimental::dynamic_extent);
+    EXPECT_EQ(subchunk.allocation_mdspan().extent(0), nelems_x.value());
+    EXPECT_EQ(subchunk.allocation_mdspan().extent(1), 2);
+    ddc::for_each(subchunk.domain(), [&](DElemXC const ixc) {
+        EXPECT_EQ(subchunk(ixc), chunk(ixc));
+    });
+
+    auto const subchunk_c = subchunk[lbound_x + 2];
+    static_assert(decltype(subchunk_c)::static_extent(0) == std::experimental::dynamic_extent);
+    EXPECT_EQ(subchunk_c.allocation_mdspan().extent(0), 2);
+    auto const subview_c = subchunk_c.span_cview();
+    for (DElemC const ic : subdom_c) {
+        EXPECT_EQ(subview_c(ic), chunk(lbound_x + 2, ic));
+    }
+}
+
+TEST(StaticExtent, ForEachOrder)
+{
+    std::vector<DElemXC> visited;
+    ddc::for_each(dom_x_c, [&](DElemXC const ixc) { visited.push_back(ixc); });
+    ASSERT_EQ(visited.size(), dom_x_c.size());
+    std::size_t i = 0;
+    for (DElemX const ix : dom_x) {
+        for (DElemC const ic : dom_c) {
+            EXPECT_EQ(visited[i], DElemXC(ix, ic));
+            ++i;
+        }
+    }
+}
+
+TEST(StaticExtent, ForEachSubdomain)
+{
+    // A subdomain of the static dimension takes the dynamic loop
+    DDomXC const subdom_x_c(dom_x.take_first(DVectX(2)), dom_c.remove_first(DVectC(1)));
+    std::vector<DElemXC> visited;
+    ddc::for_each(subdom_x_c, [&](DElemXC const ixc) { visited.push_back(ixc); });
+    ASSERT_EQ(visited.size(), 4);
+    EXPECT_EQ(visited[0], DElemXC(lbound_x, lbound_c + 1));
+    EXPECT_EQ(visited[1], DElemXC(lbound_x, lbound_c + 2));
+    EXPECT_EQ(visited[2], DElemXC(lbound_x + 1, lbound_c + 1));
+    EXPECT_EQ(visited[3], DElemXC(lbound_x + 1, lbound_c + 2));
+}
+
+TEST(StaticExtent, Deepcopy)
+{
+    ddc::Chunk<double, DDomXC> chunk(dom_x_c);
+    ddc::parallel_fill(chunk, 1.5);
+    auto const mirror = ddc::create_mirror_and_copy(chunk.span_cview());
+    static_assert(std::remove_const_t<decltype(mirror)>::static_extent(1) == 3);
+    ddc::for_each(dom_x_c, [&](DElemXC const ixc) { EXPECT_EQ(mirror(ixc), 1.5); });
+}
+
+TEST(StaticExtent, MultiChunkComponents)
+{
+    using components_type = ddc::Components<Vx, Vy, Vz>;
+    using multi_chunk_type = ddc::MultiChunk<components_type, double, DDomX>;
+    static_assert(multi_chunk_type::chunk_type::static_extent(0) == 3);
+
+    multi_chunk_type multi_chunk(dom_x);
+    ddc::parallel_fill(multi_chunk.get<Vy>(), 2.);
+    for (DElemX const ix : dom_x) {
+        EXPECT_EQ(multi_chunk.at<Vy>(ix), 2.);
+    }
+}